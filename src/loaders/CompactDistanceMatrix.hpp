@@ -0,0 +1,47 @@
+#ifndef COMPACT_DISTANCE_MATRIX_HPP
+#define COMPACT_DISTANCE_MATRIX_HPP
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Matrice des distances en simple précision, stockée d'un seul bloc.
+ *
+ * Moitié de la mémoire de DistanceMatrix et pas d'en-tête de vecteur par
+ * ligne. Les distances entières des fichiers fournis (et toute valeur
+ * entière jusqu'à 2^24) sont représentées exactement.
+ */
+class CompactDistanceMatrix {
+public:
+    CompactDistanceMatrix() = default;
+
+    /// Prend possession de n x n valeurs rangées ligne par ligne.
+    CompactDistanceMatrix(int n, std::vector<float> values)
+        : n_(n), values_(std::move(values)), symmetric_(detect_symmetry()) {}
+
+    float at(int a, int b) const { return values_[(std::size_t)a * n_ + b]; }
+    const float* row(int a) const { return values_.data() + (std::size_t)a * n_; }
+    int size() const { return n_; }
+
+    /// Mémoire occupée par les distances (octets).
+    std::size_t memory_bytes() const { return values_.size() * sizeof(float); }
+
+    /// at(a, b) == at(b, a) pour tout couple (détecté à la construction).
+    bool symmetric() const { return symmetric_; }
+
+private:
+    bool detect_symmetry() const {
+        for (int i = 0; i < n_; ++i) {
+            for (int j = 0; j < i; ++j) {
+                if (at(i, j) != at(j, i)) return false;
+            }
+        }
+        return true;
+    }
+
+    int n_ = 0;
+    std::vector<float> values_;
+    bool symmetric_ = true;
+};
+
+#endif // COMPACT_DISTANCE_MATRIX_HPP
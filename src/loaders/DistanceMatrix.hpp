@@ -0,0 +1,80 @@
+#ifndef DISTANCE_MATRIX_HPP
+#define DISTANCE_MATRIX_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Matrice des distances, partagée entre copies de TapInstance.
+ *
+ * S'utilise comme l'ancien std::vector<std::vector<double>> en lecture
+ * (dist[a][b], dist.size(), boucles for). Copier une instance, par exemple
+ * pour changer ses epsilons, ne recopie pas la matrice : n^2 doubles
+ * restent partagés.
+ *
+ * La symétrie est détectée une fois à la construction : les solveurs
+ * gardent l'évaluation du 2-opt par ses seuls arcs frontières quand
+ * dist[a][b] == dist[b][a] pour tout couple.
+ *
+ * Seule append() modifie la matrice, après l'avoir recopiée si elle est
+ * partagée : les autres instances gardent l'ancienne.
+ */
+class DistanceMatrix {
+public:
+    using Row = std::vector<double>;
+
+    DistanceMatrix() : rows_(std::make_shared<std::vector<Row>>()) {}
+
+    /// Prend possession des lignes (n x n).
+    explicit DistanceMatrix(std::vector<Row> rows)
+        : rows_(std::make_shared<std::vector<Row>>(std::move(rows))),
+          symmetric_(detect_symmetry(*rows_)) {}
+
+    const Row& operator[](std::size_t i) const { return (*rows_)[i]; }
+    std::size_t size() const { return rows_->size(); }
+    std::vector<Row>::const_iterator begin() const { return rows_->cbegin(); }
+    std::vector<Row>::const_iterator end() const { return rows_->cend(); }
+
+    /// Nombre d'instances partageant cette matrice.
+    long use_count() const { return rows_.use_count(); }
+
+    /// dist[a][b] == dist[b][a] pour tout couple.
+    bool symmetric() const { return symmetric_; }
+
+    /**
+     * @brief Ajoute une requête (ligne et colonne n).
+     *
+     * Croissance en place à capacité amortie ; la matrice n'est recopiée
+     * que si elle est encore partagée (copie sur écriture).
+     *
+     * @param out Distances nouvelle -> existantes (n valeurs)
+     * @param in  Distances existantes -> nouvelle (n valeurs)
+     */
+    void append(const Row& out, const Row& in) {
+        if (rows_.use_count() > 1) rows_ = std::make_shared<std::vector<Row>>(*rows_);
+        std::vector<Row>& rows = *rows_;
+        const std::size_t n = rows.size();
+        for (std::size_t i = 0; i < n; ++i) rows[i].push_back(in[i]);
+        rows.emplace_back();
+        rows.back().reserve(rows.front().capacity());
+        rows.back().assign(out.begin(), out.end());
+        rows.back().push_back(0.0);
+        symmetric_ = symmetric_ && out == in;
+    }
+
+private:
+    static bool detect_symmetry(const std::vector<Row>& rows) {
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            for (std::size_t j = 0; j < i; ++j) {
+                if (rows[i][j] != rows[j][i]) return false;
+            }
+        }
+        return true;
+    }
+
+    std::shared_ptr<std::vector<Row>> rows_;
+    bool symmetric_ = true;
+};
+
+#endif // DISTANCE_MATRIX_HPP
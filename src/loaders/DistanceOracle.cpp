@@ -0,0 +1,88 @@
+#include "loaders/DistanceOracle.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+/**
+ * @file DistanceOracle.cpp
+ * @brief Oracle de distances sur caractéristiques et cache de lignes par thread
+ */
+
+namespace {
+
+/// Lignes conservées par thread (8 lignes de 100 000 requêtes = 3,2 Mo).
+constexpr int kCachedRows = 8;
+
+std::atomic<std::uint64_t> next_oracle_id{1};
+
+/**
+ * @brief Cache associatif de lignes, remplacement du moins récemment utilisé.
+ *
+ * Les lignes sont étiquetées par (oracle, requête) : un oracle détruit
+ * puis un autre alloué à la même adresse ne peuvent pas se confondre.
+ */
+struct RowCache {
+    std::uint64_t owner[kCachedRows] = {};
+    int query[kCachedRows] = {};
+    std::uint64_t last_use[kCachedRows] = {};
+    std::vector<float> rows[kCachedRows];
+    std::uint64_t clock = 0;
+};
+
+thread_local RowCache row_cache;
+
+} // namespace
+
+DistanceOracle::DistanceOracle(int n, int dims, std::vector<float> features, Metric metric)
+    : n_(n), dims_(dims), features_(std::move(features)), metric_(metric),
+      id_(next_oracle_id.fetch_add(1)) {
+    if (n < 0 || dims <= 0 || features_.size() != (std::size_t)n * dims) {
+        throw std::invalid_argument("Inconsistent oracle dimensions");
+    }
+}
+
+const float* DistanceOracle::row(int a) const {
+    RowCache& c = row_cache;
+    ++c.clock;
+    int slot = 0;
+    for (int s = 0; s < kCachedRows; ++s) {
+        if (c.owner[s] == id_ && c.query[s] == a) {
+            c.last_use[s] = c.clock;
+            return c.rows[s].data();
+        }
+        if (c.last_use[s] < c.last_use[slot]) slot = s;
+    }
+    std::vector<float>& r = c.rows[slot];
+    r.resize(n_);
+    for (int b = 0; b < n_; ++b) r[b] = (float)(*this)(a, b);
+    c.owner[slot] = id_;
+    c.query[slot] = a;
+    c.last_use[slot] = c.clock;
+    return r.data();
+}
+
+std::vector<float> DistanceOracle::permuted_features(const std::vector<int>& order) const {
+    std::vector<float> out((std::size_t)n_ * dims_);
+    for (int i = 0; i < n_; ++i) {
+        const float* src = features(order[i]);
+        std::copy(src, src + dims_, out.begin() + (std::size_t)i * dims_);
+    }
+    return out;
+}
+
+DistanceOracle::Metric parse_oracle_metric(const std::string& name) {
+    if (name == "manhattan") return DistanceOracle::Metric::Manhattan;
+    if (name == "chebyshev") return DistanceOracle::Metric::Chebyshev;
+    if (name == "euclidean") return DistanceOracle::Metric::Euclidean;
+    throw std::invalid_argument("Unknown metric: " + name);
+}
+
+const char* oracle_metric_name(DistanceOracle::Metric metric) {
+    switch (metric) {
+    case DistanceOracle::Metric::Manhattan: return "manhattan";
+    case DistanceOracle::Metric::Chebyshev: return "chebyshev";
+    case DistanceOracle::Metric::Euclidean: return "euclidean";
+    }
+    return "?";
+}
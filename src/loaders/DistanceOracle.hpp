@@ -0,0 +1,100 @@
+#ifndef DISTANCE_ORACLE_HPP
+#define DISTANCE_ORACLE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Distances calculées à la demande à partir de caractéristiques par requête.
+ *
+ * Chaque requête est décrite par dims coordonnées (position sur une grille,
+ * vecteur de caractéristiques) ; la distance est une métrique sur ces
+ * vecteurs. La mémoire est en O(n * dims) au lieu de O(n^2) : 100 000
+ * requêtes en 2D tiennent en moins d'un mégaoctet.
+ *
+ * row() renvoie une ligne complète (distances d'une requête à toutes les
+ * autres) conservée dans un petit cache propre au thread appelant : les
+ * parcours « une requête contre toutes » répétés (medoids, plus proches
+ * voisins) ne recalculent pas la ligne. Les lignes sont en simple
+ * précision : elles servent à comparer des distances, les budgets se
+ * calculent avec operator().
+ */
+class DistanceOracle {
+public:
+    enum class Metric {
+        Manhattan,   ///< Somme des |dx|
+        Chebyshev,   ///< Max des |dx|
+        Euclidean    ///< Racine de la somme des dx^2
+    };
+
+    /**
+     * @param n        Nombre de requêtes
+     * @param dims     Coordonnées par requête
+     * @param features n * dims valeurs, requête par requête
+     * @param metric   Métrique
+     * @throws std::invalid_argument si les dimensions sont incohérentes
+     */
+    DistanceOracle(int n, int dims, std::vector<float> features, Metric metric);
+
+    DistanceOracle(const DistanceOracle&) = delete;
+    DistanceOracle& operator=(const DistanceOracle&) = delete;
+
+    int size() const { return n_; }
+    int dims() const { return dims_; }
+    Metric metric() const { return metric_; }
+    const float* features(int q) const { return features_.data() + (std::size_t)q * dims_; }
+
+    double operator()(int a, int b) const {
+        const float* fa = features(a);
+        const float* fb = features(b);
+        double acc = 0.0;
+        switch (metric_) {
+        case Metric::Manhattan:
+            for (int k = 0; k < dims_; ++k) acc += std::fabs((double)fa[k] - fb[k]);
+            return acc;
+        case Metric::Chebyshev:
+            for (int k = 0; k < dims_; ++k) acc = std::fmax(acc, std::fabs((double)fa[k] - fb[k]));
+            return acc;
+        case Metric::Euclidean:
+            for (int k = 0; k < dims_; ++k) {
+                double d = (double)fa[k] - fb[k];
+                acc += d * d;
+            }
+            return std::sqrt(acc);
+        }
+        return acc;
+    }
+
+    /// Distances de a à toutes les requêtes (cache du thread, valide jusqu'à 8 autres appels).
+    const float* row(int a) const;
+
+    /// Oracle renuméroté : la requête i devient l'ancienne requête order[i].
+    std::vector<float> permuted_features(const std::vector<int>& order) const;
+
+    /// Mémoire occupée par les caractéristiques (octets).
+    std::size_t memory_bytes() const { return features_.size() * sizeof(float); }
+
+private:
+    int n_;
+    int dims_;
+    std::vector<float> features_;
+    Metric metric_;
+    std::uint64_t id_;   ///< Identifiant unique (étiquette des lignes en cache)
+};
+
+/**
+ * @brief Analyse un nom de métrique ("manhattan", "chebyshev", "euclidean").
+ *
+ * @throws std::invalid_argument si le nom n'est pas reconnu
+ */
+DistanceOracle::Metric parse_oracle_metric(const std::string& name);
+
+/**
+ * @brief Nom d'une métrique (inverse de parse_oracle_metric).
+ */
+const char* oracle_metric_name(DistanceOracle::Metric metric);
+
+#endif // DISTANCE_ORACLE_HPP
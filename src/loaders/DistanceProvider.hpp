@@ -0,0 +1,68 @@
+#ifndef DISTANCE_PROVIDER_HPP
+#define DISTANCE_PROVIDER_HPP
+
+#include "loaders/TapInstance.hpp"
+
+/**
+ * @file DistanceProvider.hpp
+ * @brief Accès aux distances spécialisé à la compilation selon la représentation
+ *
+ * Les trois vues ont la même interface :
+ *   - D(a, b)   : distance de a à b ;
+ *   - D.row(a)  : pointeur sur les distances de a à toutes les requêtes ;
+ *   - D.size()  : nombre de requêtes ;
+ *   - D.symmetric() : D(a, b) == D(b, a) pour tout couple.
+ * Un algorithme écrit comme modèle sur D est instancié une fois par vue :
+ * la vue dense compile exactement comme l'accès I.dist[a][b], sans
+ * indirection ni test de représentation dans la boucle.
+ */
+
+/// Vue sur la matrice dense (DistanceMatrix).
+struct DenseDistances {
+    const DistanceMatrix& m;
+
+    double operator()(int a, int b) const { return m[a][b]; }
+    const double* row(int a) const { return m[a].data(); }
+    int size() const { return (int)m.size(); }
+    bool symmetric() const { return m.symmetric(); }
+};
+
+/// Vue sur la matrice en simple précision (CompactDistanceMatrix).
+struct CompactDistances {
+    const CompactDistanceMatrix& m;
+
+    double operator()(int a, int b) const { return m.at(a, b); }
+    const float* row(int a) const { return m.row(a); }
+    int size() const { return m.size(); }
+    bool symmetric() const { return m.symmetric(); }
+};
+
+/// Vue sur l'oracle (distances calculées, lignes en cache par thread).
+struct OracleDistances {
+    const DistanceOracle& o;
+
+    double operator()(int a, int b) const { return o(a, b); }
+    const float* row(int a) const { return o.row(a); }
+    int size() const { return o.size(); }
+    bool symmetric() const { return true; }   // Toutes les métriques sont symétriques
+};
+
+/**
+ * @brief Appelle f avec la vue correspondant à la représentation de I.
+ *
+ * Le seul aiguillage à l'exécution est ici ; f (lambda générique ou
+ * foncteur modèle) est instanciée pour chaque vue.
+ *
+ *     double d = visit_distances(I, [&](const auto& D) { return D(a, b); });
+ */
+template <typename F>
+decltype(auto) visit_distances(const TapInstance& I, F&& f) {
+    switch (I.backend) {
+    case DistanceBackend::Compact: return f(CompactDistances{*I.compact});
+    case DistanceBackend::Oracle:  return f(OracleDistances{*I.oracle});
+    case DistanceBackend::Dense:   break;
+    }
+    return f(DenseDistances{I.dist});
+}
+
+#endif // DISTANCE_PROVIDER_HPP
@@ -28,11 +28,12 @@ load_opt_values(const std::string& filename) {
         return result;  // retourne map vide
     }
 
-    // Lire et ignorer la première ligne (en-tête)
-    std::getline(file, line);
+    // Lire et ignorer les commentaires '#' puis la ligne d'en-tête
+    while (std::getline(file, line) && !line.empty() && line[0] == '#') {}
 
     // Traiter chaque ligne du fichier
     while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
         std::istringstream iss(line);
         std::string name, value_str;
 
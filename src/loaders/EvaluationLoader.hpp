@@ -22,6 +22,7 @@ struct EvaluationEntry {
  * Each non-header line should have the format:
  *     instance_name;value[*]
  * where a trailing '*' indicates the solution is not proven optimal.
+ * Lines starting with '#' (such as the note at the top of opt.txt) are skipped.
  *
  * @param filename Path to the optimal values file.
  * @return Map from instance filename to its EvaluationEntry.
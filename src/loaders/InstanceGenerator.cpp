@@ -0,0 +1,231 @@
+#include "loaders/InstanceGenerator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+/**
+ * @file InstanceGenerator.cpp
+ * @brief Génération d'instances TAP synthétiques pour les études de passage à l'échelle
+ *
+ * Ce fichier fournit :
+ * - parse_distribution : lecture d'une loi de tirage depuis la ligne de commande
+ * - generate_instance  : génération déterministe (par graine) en mémoire
+ * - write_instance_dat / append_instance_spec : export au format des fichiers fournis
+ * - write_instance_coords : export des instances Oracle (coordonnées, O(n))
+ */
+
+namespace {
+
+/**
+ * @brief Réel uniforme dans [0, 1) à partir de 53 bits du générateur.
+ */
+double unit(std::mt19937_64& rng) {
+    return (double)(rng() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @brief Tire une valeur selon la loi demandée.
+ *
+ * Box-Muller pour la normale, inversion pour l'exponentielle : aucune
+ * distribution de <random> n'est utilisée car leurs sorties dépendent
+ * de l'implémentation.
+ */
+double draw(const ValueDistribution& law, std::mt19937_64& rng) {
+    using Kind = ValueDistribution::Kind;
+    double v = 0.0;
+    switch (law.kind) {
+    case Kind::Uniform:
+        return law.a + (law.b - law.a) * unit(rng);
+    case Kind::UniformInt: {
+        long lo = std::lround(law.a);
+        long hi = std::lround(law.b);
+        unsigned long span = (unsigned long)(hi - lo + 1);
+        return (double)(lo + (long)(rng() % span));
+    }
+    case Kind::Normal: {
+        double u1 = 1.0 - unit(rng);   // (0, 1] pour éviter log(0)
+        double u2 = unit(rng);
+        v = law.a + law.b * std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2);
+        break;
+    }
+    case Kind::Exponential:
+        v = -law.a * std::log(1.0 - unit(rng));
+        break;
+    }
+    return std::clamp(v, law.min, law.max);
+}
+
+} // namespace
+
+ValueDistribution parse_distribution(const std::string& text) {
+    std::vector<std::string> parts;
+    std::istringstream iss(text);
+    std::string token;
+    while (std::getline(iss, token, ':')) parts.push_back(token);
+    if (parts.empty()) {
+        throw std::invalid_argument("Empty distribution");
+    }
+
+    std::vector<double> args;
+    for (size_t i = 1; i < parts.size(); ++i) args.push_back(std::stod(parts[i]));
+
+    ValueDistribution law;
+    const std::string& kind = parts[0];
+    if (kind == "uniform" && args.size() == 2) {
+        law.kind = ValueDistribution::Kind::Uniform;
+        law.a = args[0];
+        law.b = args[1];
+    } else if (kind == "int" && args.size() == 2) {
+        law.kind = ValueDistribution::Kind::UniformInt;
+        law.a = args[0];
+        law.b = args[1];
+        if (law.b < law.a) throw std::invalid_argument("Empty integer range: " + text);
+    } else if (kind == "normal" && (args.size() == 2 || args.size() == 4)) {
+        law.kind = ValueDistribution::Kind::Normal;
+        law.a = args[0];
+        law.b = args[1];
+        if (args.size() == 4) { law.min = args[2]; law.max = args[3]; }
+    } else if (kind == "exp" && (args.size() == 1 || args.size() == 3)) {
+        law.kind = ValueDistribution::Kind::Exponential;
+        law.a = args[0];
+        if (args.size() == 3) { law.min = args[1]; law.max = args[2]; }
+    } else {
+        throw std::invalid_argument("Unknown distribution: " + text);
+    }
+    return law;
+}
+
+TapInstance generate_instance(const GeneratorConfig& cfg, const std::string& name) {
+    if (cfg.n <= 0 || cfg.grid_side <= 0) {
+        throw std::invalid_argument("Generator needs n > 0 and grid_side > 0");
+    }
+    const int n = cfg.n;
+    std::mt19937_64 rng(cfg.seed);
+
+    // 1) Intérêts puis temps (les temps nuls rendraient le ratio de seed infini)
+    std::vector<double> interest(n), time(n);
+    for (int i = 0; i < n; ++i) interest[i] = draw(cfg.interest, rng);
+    for (int i = 0; i < n; ++i) time[i] = std::max(draw(cfg.time, rng), 1e-9);
+
+    // 2) Positions sur la grille
+    std::vector<int> x(n), y(n);
+    for (int i = 0; i < n; ++i) {
+        x[i] = (int)(rng() % (unsigned)cfg.grid_side);
+        y[i] = (int)(rng() % (unsigned)cfg.grid_side);
+    }
+
+    // 3) Epsilons : valeurs imposées, sinon dérivées comme dans baselines.txt
+    double total_time = 0.0;
+    for (double t : time) total_time += t;
+    double eps_t = cfg.epsilon_time > 0 ? cfg.epsilon_time
+                                        : std::round(cfg.epsilon_time_ratio * total_time);
+    double eps_d = cfg.epsilon_distance > 0 ? cfg.epsilon_distance
+                                            : std::round(cfg.epsilon_distance_per_query * n);
+
+    // 4) Distances : oracle sur les positions, ou matrice entière symétrique
+    if (cfg.implicit_distances) {
+        std::vector<float> features(2 * (std::size_t)n);
+        for (int i = 0; i < n; ++i) {
+            features[2 * (std::size_t)i] = (float)x[i];
+            features[2 * (std::size_t)i + 1] = (float)y[i];
+        }
+        auto metric = cfg.metric == GridMetric::Manhattan ? DistanceOracle::Metric::Manhattan
+                                                          : DistanceOracle::Metric::Chebyshev;
+        auto oracle = std::make_shared<const DistanceOracle>(n, 2, std::move(features), metric);
+        return TapInstance(name, std::move(interest), std::move(time), std::move(oracle),
+                           eps_t, eps_d);
+    }
+
+    std::vector<std::vector<double>> dist(n, std::vector<double>(n, 0.0));
+    for (int i = 0; i < n; ++i) {
+        for (int j = i + 1; j < n; ++j) {
+            int dx = std::abs(x[i] - x[j]);
+            int dy = std::abs(y[i] - y[j]);
+            int d = (cfg.metric == GridMetric::Manhattan) ? dx + dy : std::max(dx, dy);
+            dist[i][j] = dist[j][i] = d;
+        }
+    }
+    return TapInstance(name, std::move(interest), std::move(time), std::move(dist), eps_t, eps_d);
+}
+
+InstanceSpec make_instance_spec(const TapInstance& instance, const std::string& filename) {
+    return InstanceSpec{filename, instance.epsilon_t, instance.epsilon_d};
+}
+
+void write_instance_dat(const TapInstance& I, const std::string& filepath) {
+    std::ofstream out(filepath);
+    if (!out) {
+        throw std::runtime_error("Cannot write file: " + filepath);
+    }
+    out << std::setprecision(17);
+
+    out << I.size << "\n";
+    for (int i = 0; i < I.size; ++i) out << (i ? " " : "") << I.interest[i];
+    out << "\n";
+    for (int i = 0; i < I.size; ++i) out << (i ? " " : "") << I.time[i];
+    out << "\n";
+    for (int i = 0; i < I.size; ++i) {
+        for (int j = 0; j < I.size; ++j) out << (j ? " " : "") << I.distance(i, j);
+        out << "\n";
+    }
+    if (!out) {
+        throw std::runtime_error("Write failed: " + filepath);
+    }
+}
+
+void write_instance_coords(const TapInstance& I, const std::string& filepath) {
+    if (I.backend != DistanceBackend::Oracle) {
+        throw std::invalid_argument("Not an oracle instance: " + I.filename);
+    }
+    std::ofstream out(filepath);
+    if (!out) {
+        throw std::runtime_error("Cannot write file: " + filepath);
+    }
+    out << std::setprecision(17);
+
+    const DistanceOracle& O = *I.oracle;
+    out << "coords " << I.size << " " << O.dims() << " " << oracle_metric_name(O.metric()) << "\n";
+    for (int i = 0; i < I.size; ++i) out << (i ? " " : "") << I.interest[i];
+    out << "\n";
+    for (int i = 0; i < I.size; ++i) out << (i ? " " : "") << I.time[i];
+    out << "\n";
+    out << std::setprecision(9);
+    for (int i = 0; i < I.size; ++i) {
+        const float* f = O.features(i);
+        for (int k = 0; k < O.dims(); ++k) out << (k ? " " : "") << f[k];
+        out << "\n";
+    }
+    if (!out) {
+        throw std::runtime_error("Write failed: " + filepath);
+    }
+}
+
+void append_instance_spec(const InstanceSpec& spec, const std::string& spec_file) {
+    // Détecter un fichier existant et s'il se termine par un saut de ligne
+    bool exists = false;
+    bool needs_newline = false;
+    {
+        std::ifstream in(spec_file, std::ios::binary);
+        if (in) {
+            exists = true;
+            in.seekg(0, std::ios::end);
+            if (in.tellg() > 0) {
+                in.seekg(-1, std::ios::end);
+                needs_newline = in.get() != '\n';
+            }
+        }
+    }
+
+    std::ofstream out(spec_file, std::ios::app);
+    if (!out) {
+        throw std::runtime_error("Cannot write file: " + spec_file);
+    }
+    if (!exists) out << "instances;epsilon_time;epsilon_distance\n";
+    if (needs_newline) out << "\n";
+    out << spec.filename << ";" << spec.epsilon_time << ";" << spec.epsilon_distance << "\n";
+}
@@ -0,0 +1,119 @@
+#ifndef INSTANCE_GENERATOR_HPP
+#define INSTANCE_GENERATOR_HPP
+
+#include <cstdint>
+#include <string>
+#include "loaders/TapInstance.hpp"
+#include "loaders/InstanceLoader.hpp"
+
+/**
+ * @brief Loi de tirage utilisée pour l'intérêt ou le temps des requêtes.
+ *
+ * Les tirages reposent sur des transformations explicites d'un mt19937_64,
+ * pour que la même graine donne la même instance quelle que soit la
+ * bibliothèque standard utilisée.
+ */
+struct ValueDistribution {
+    enum class Kind {
+        Uniform,      ///< Réel uniforme dans [a, b)
+        UniformInt,   ///< Entier uniforme dans [a, b]
+        Normal,       ///< Normale de moyenne a et d'écart-type b, tronquée à [min, max]
+        Exponential   ///< Exponentielle de moyenne a, tronquée à [min, max]
+    };
+    Kind kind = Kind::Uniform;
+    double a = 0.0;
+    double b = 1.0;
+    double min = 0.0;     ///< Borne basse appliquée après tirage (Normal, Exponential)
+    double max = 1e300;   ///< Borne haute appliquée après tirage (Normal, Exponential)
+};
+
+/**
+ * @brief Métrique utilisée sur la grille pour les distances entre requêtes.
+ *
+ * Les deux métriques sont entières, symétriques et respectent l'inégalité
+ * triangulaire, comme les fichiers .dat fournis.
+ */
+enum class GridMetric {
+    Manhattan,   ///< |dx| + |dy|
+    Chebyshev    ///< max(|dx|, |dy|)
+};
+
+/**
+ * @brief Paramètres du générateur d'instances TAP synthétiques.
+ *
+ * Les valeurs par défaut reproduisent les caractéristiques des instances
+ * fournies (intérêt dans [0, 1), temps entiers dans [5, 50], distances
+ * entières de 0 à 8, epsilons proches de ceux de baselines.txt).
+ */
+struct GeneratorConfig {
+    int n = 400;                          ///< Nombre de requêtes
+    std::uint64_t seed = 0;               ///< Graine (génération déterministe)
+    ValueDistribution interest{ValueDistribution::Kind::Uniform, 0.0, 1.0, 0.0, 1.0};
+    ValueDistribution time{ValueDistribution::Kind::UniformInt, 5.0, 50.0, 1.0, 1e300};
+    int grid_side = 5;                    ///< Côté de la grille où sont placées les requêtes
+    GridMetric metric = GridMetric::Manhattan;
+    double epsilon_time_ratio = 0.6;      ///< epsilon_time = ratio * somme des temps
+    double epsilon_distance_per_query = 1.35; ///< epsilon_distance = facteur * n
+    double epsilon_time = -1.0;           ///< Valeur imposée si > 0 (ignore le ratio)
+    double epsilon_distance = -1.0;       ///< Valeur imposée si > 0 (ignore le facteur)
+    bool implicit_distances = false;      ///< Instance Oracle (coordonnées) au lieu d'une matrice n x n
+};
+
+/**
+ * @brief Analyse une loi au format texte "uniform:a:b", "int:a:b",
+ *        "normal:mu:sigma[:min:max]" ou "exp:mean[:min:max]".
+ *
+ * @param text Description textuelle de la loi
+ * @return La loi correspondante
+ * @throws std::invalid_argument si le format n'est pas reconnu
+ */
+ValueDistribution parse_distribution(const std::string& text);
+
+/**
+ * @brief Génère une instance TAP entièrement en mémoire.
+ *
+ * Les epsilons sont dérivés de la configuration (voir GeneratorConfig).
+ * Avec implicit_distances, les positions sur la grille sont conservées
+ * dans un DistanceOracle et aucune matrice n'est construite : mêmes
+ * distances, mémoire en O(n).
+ *
+ * @param cfg  Paramètres de génération
+ * @param name Nom logique donné à l'instance
+ * @return L'instance générée
+ */
+TapInstance generate_instance(const GeneratorConfig& cfg, const std::string& name);
+
+/**
+ * @brief Construit la ligne de spécification (format baselines.txt) associée.
+ */
+InstanceSpec make_instance_spec(const TapInstance& instance, const std::string& filename);
+
+/**
+ * @brief Écrit une instance au format .dat (même format que tap_14_400.dat).
+ *
+ * @throws std::runtime_error si le fichier ne peut pas être écrit
+ */
+void write_instance_dat(const TapInstance& instance, const std::string& filepath);
+
+/**
+ * @brief Écrit une instance Oracle au format coordonnées.
+ *
+ * Première ligne "coords n dims metric", puis les intérêts, les temps et
+ * une ligne de dims coordonnées par requête. Relu par le constructeur de
+ * TapInstance comme une instance Oracle.
+ *
+ * @throws std::invalid_argument si l'instance n'est pas Oracle
+ * @throws std::runtime_error si le fichier ne peut pas être écrit
+ */
+void write_instance_coords(const TapInstance& instance, const std::string& filepath);
+
+/**
+ * @brief Ajoute une spécification à un fichier au format baselines.txt.
+ *
+ * L'en-tête est écrit si le fichier n'existe pas encore.
+ *
+ * @throws std::runtime_error si le fichier ne peut pas être écrit
+ */
+void append_instance_spec(const InstanceSpec& spec, const std::string& spec_file);
+
+#endif // INSTANCE_GENERATOR_HPP
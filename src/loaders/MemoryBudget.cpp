@@ -0,0 +1,107 @@
+#include "loaders/MemoryBudget.hpp"
+
+#include <fstream>
+#include <string>
+
+/**
+ * @file MemoryBudget.cpp
+ * @brief Estimation de la mémoire des instances, budget du loader et mesure du RSS
+ */
+
+namespace {
+
+std::string megabytes(std::size_t bytes) {
+    return std::to_string((bytes + (1u << 20) - 1) >> 20) + " MB";
+}
+
+/// Valeur en ko d'une ligne de /proc/self/status ("VmRSS:", "VmHWM:"), convertie en octets.
+std::size_t proc_status_bytes(const std::string& key) {
+    std::ifstream in("/proc/self/status");
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.compare(0, key.size(), key) != 0) continue;
+        return std::stoull(line.substr(key.size())) * 1024;
+    }
+    return 0;
+}
+
+} // namespace
+
+MemoryBudgetExceeded::MemoryBudgetExceeded(const std::string& name, std::size_t needed,
+                                           std::size_t budget)
+    : std::runtime_error(name + " needs " + megabytes(needed) + ", memory budget is "
+                         + megabytes(budget)),
+      needed_(needed), budget_(budget) {}
+
+DistanceBackend MemoryBudget::choose_storage(int n, DistanceBackend requested,
+                                             const std::string& name) const {
+    if (bytes == 0) return requested;
+    std::size_t need = estimate_instance_bytes(n, requested);
+    if (need <= bytes) return requested;
+    if (requested == DistanceBackend::Dense && allow_compact) {
+        need = estimate_instance_bytes(n, DistanceBackend::Compact);
+        if (need <= bytes) return DistanceBackend::Compact;
+    }
+    throw MemoryBudgetExceeded(name, need, bytes);
+}
+
+std::size_t estimate_instance_bytes(int n, DistanceBackend storage, int dims) {
+    const std::size_t N = (std::size_t)n;
+    std::size_t distances = 0;
+    switch (storage) {
+    case DistanceBackend::Dense:   distances = N * (N * sizeof(double) + sizeof(std::vector<double>)); break;
+    case DistanceBackend::Compact: distances = N * N * sizeof(float); break;
+    case DistanceBackend::Oracle:  distances = N * (std::size_t)dims * sizeof(float); break;
+    }
+    return distances + 2 * N * sizeof(double) + sizeof(TapInstance);
+}
+
+std::size_t estimate_file_bytes(const std::string& filepath, DistanceBackend storage,
+                                const MemoryBudget& budget, int* size) {
+    std::ifstream in(filepath);
+    std::string first;
+    if (!in || !(in >> first)) throw std::runtime_error("Cannot open file: " + filepath);
+    if (first == "coords") {
+        int n = 0, dims = 0;
+        in >> n >> dims;
+        if (size) *size = n;
+        return estimate_instance_bytes(n, DistanceBackend::Oracle, dims);
+    }
+    int n = std::stoi(first);
+    if (size) *size = n;
+    return estimate_instance_bytes(n, budget.choose_storage(n, storage, filepath));
+}
+
+void MemoryGate::acquire(std::size_t bytes) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] { return capacity_ == 0 || in_use_ == 0 || in_use_ + bytes <= capacity_; });
+    in_use_ += bytes;
+}
+
+void MemoryGate::release(std::size_t bytes) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        in_use_ -= bytes;
+    }
+    cv_.notify_all();
+}
+
+std::size_t MemoryGate::in_use() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return in_use_;
+}
+
+std::size_t current_rss_bytes() {
+    return proc_status_bytes("VmRSS:");
+}
+
+std::size_t peak_rss_bytes() {
+    return proc_status_bytes("VmHWM:");
+}
+
+bool reset_peak_rss() {
+    std::ofstream out("/proc/self/clear_refs");
+    out << "5";
+    out.flush();
+    return (bool)out;
+}
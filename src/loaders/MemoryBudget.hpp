@@ -0,0 +1,137 @@
+#ifndef MEMORY_BUDGET_HPP
+#define MEMORY_BUDGET_HPP
+
+#include "loaders/TapInstance.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Instance refusée : elle ne tient pas dans le budget mémoire.
+ */
+class MemoryBudgetExceeded : public std::runtime_error {
+public:
+    MemoryBudgetExceeded(const std::string& name, std::size_t needed, std::size_t budget);
+
+    std::size_t needed() const { return needed_; }   ///< Octets nécessaires (meilleure représentation permise)
+    std::size_t budget() const { return budget_; }   ///< Budget (octets)
+
+private:
+    std::size_t needed_;
+    std::size_t budget_;
+};
+
+/**
+ * @brief Budget mémoire d'une instance chargée depuis un fichier.
+ *
+ * Vérifié par le loader après lecture de la taille n et avant l'allocation
+ * de la matrice : si la représentation demandée ne tient pas, l'instance
+ * est chargée en Compact (moitié de la mémoire) lorsque c'est permis,
+ * sinon refusée par MemoryBudgetExceeded. Seul decomp accepte une
+ * instance Compact ; les autres solveurs la refusent à leur tour.
+ */
+struct MemoryBudget {
+    std::size_t bytes = 0;        ///< Budget (0 = illimité)
+    bool allow_compact = true;    ///< Charger en Compact plutôt que refuser
+
+    /**
+     * @brief Représentation des distances d'une instance de n requêtes.
+     *
+     * @param n         Nombre de requêtes
+     * @param requested Représentation demandée (Dense ou Compact)
+     * @param name      Nom de l'instance (message d'erreur)
+     * @return requested si elle tient, sinon Compact si elle tient et est permise
+     * @throws MemoryBudgetExceeded sinon
+     */
+    DistanceBackend choose_storage(int n, DistanceBackend requested,
+                                   const std::string& name) const;
+};
+
+/**
+ * @brief Mémoire d'une instance de n requêtes lue dans la représentation donnée (octets).
+ *
+ * Même décompte que TapInstance::memory_usage().total(), avant chargement.
+ *
+ * @param n       Nombre de requêtes
+ * @param storage Dense ou Compact
+ * @param dims    Dimensions des coordonnées (Oracle seulement)
+ */
+std::size_t estimate_instance_bytes(int n, DistanceBackend storage, int dims = 0);
+
+/**
+ * @brief Mémoire que prendra une instance chargée depuis un fichier (octets).
+ *
+ * Ne lit que l'en-tête du fichier et applique le budget comme le loader.
+ *
+ * @param size Si non nul, reçoit le nombre de requêtes
+ * @throws std::runtime_error si le fichier ne peut pas être lu
+ * @throws MemoryBudgetExceeded si l'instance serait refusée
+ */
+std::size_t estimate_file_bytes(const std::string& filepath, DistanceBackend storage,
+                                const MemoryBudget& budget, int* size = nullptr);
+
+/**
+ * @brief Répartit un budget mémoire entre résolutions simultanées.
+ *
+ * Une résolution réserve l'estimation de son instance et de la mémoire de
+ * travail de son solveur avant de la charger, et attend tant que la somme des réservations dépasserait le budget. Une
+ * résolution seule est toujours admise : le budget de chacune est vérifié
+ * par le loader.
+ */
+class MemoryGate {
+public:
+    /// @param bytes Budget (0 = illimité)
+    explicit MemoryGate(std::size_t bytes) : capacity_(bytes) {}
+
+    /// Réserve bytes, en attendant la libération d'autres réservations si besoin.
+    void acquire(std::size_t bytes);
+
+    /// Libère une réservation.
+    void release(std::size_t bytes);
+
+    /// Octets réservés.
+    std::size_t in_use() const;
+
+private:
+    std::size_t capacity_;
+    std::size_t in_use_ = 0;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+/**
+ * @brief Réservation sur un MemoryGate, libérée en fin de portée.
+ */
+class MemoryReservation {
+public:
+    MemoryReservation(MemoryGate& gate, std::size_t bytes) : gate_(gate), bytes_(bytes) {
+        gate_.acquire(bytes_);
+    }
+    ~MemoryReservation() { gate_.release(bytes_); }
+
+    MemoryReservation(const MemoryReservation&) = delete;
+    MemoryReservation& operator=(const MemoryReservation&) = delete;
+
+private:
+    MemoryGate& gate_;
+    std::size_t bytes_;
+};
+
+/// Mémoire résidente du processus (octets, 0 si /proc indisponible).
+std::size_t current_rss_bytes();
+
+/// Pic de mémoire résidente du processus (octets, 0 si /proc indisponible).
+std::size_t peak_rss_bytes();
+
+/**
+ * @brief Ramène le pic de mémoire résidente au RSS courant.
+ *
+ * Permet de mesurer le pic d'une seule instance (Linux 4.0 et plus).
+ *
+ * @return false si le noyau ne le permet pas (pic depuis le début du processus)
+ */
+bool reset_peak_rss();
+
+#endif // MEMORY_BUDGET_HPP
@@ -1,4 +1,6 @@
 #include "loaders/TapInstance.hpp"
+#include "loaders/DistanceProvider.hpp"
+#include "loaders/MemoryBudget.hpp"
 #include <iostream>
 #include <iomanip>
 
@@ -11,33 +13,96 @@
  * @param filepath Chemin vers le fichier d'instance (.dat)
  * @param eps_t    Contrainte de temps maximale
  * @param eps_d    Contrainte de distance maximale
+ * @param storage  Représentation de la matrice lue
+ * @param budget   Budget mémoire (optionnel)
  */
-TapInstance::TapInstance(const std::string& filepath, double eps_t, double eps_d)
+TapInstance::TapInstance(const std::string& filepath, double eps_t, double eps_d,
+                         DistanceBackend storage, const MemoryBudget* budget)
     : epsilon_t(eps_t), epsilon_d(eps_d), filename(filepath) {
     // Charger les données (size, interest, time, dist)
-    load_instance(filepath);
+    load_instance(filepath, storage, budget);
 }
 
 /**
- * @brief Charge une instance TAP depuis un fichier .dat.
+ * @brief Constructeur en mémoire de TapInstance.
+ *
+ * Reprend directement les vecteurs fournis (déplacés) après
+ * vérification de la cohérence des dimensions.
+ */
+TapInstance::TapInstance(const std::string& name,
+                         std::vector<double> interest_v,
+                         std::vector<double> time_v,
+                         std::vector<std::vector<double>> dist_m,
+                         double eps_t, double eps_d)
+    : size((int)interest_v.size()),
+      interest(std::move(interest_v)),
+      time(std::move(time_v)),
+      dist(std::move(dist_m)),
+      epsilon_t(eps_t), epsilon_d(eps_d), filename(name) {
+    if ((int)time.size() != size || (int)dist.size() != size) {
+        throw std::invalid_argument("Inconsistent instance dimensions: " + name);
+    }
+    for (const auto& row : dist) {
+        if ((int)row.size() != size) {
+            throw std::invalid_argument("Distance matrix is not square: " + name);
+        }
+    }
+}
+
+/**
+ * @brief Constructeur en mémoire d'une instance à distances implicites.
+ */
+TapInstance::TapInstance(const std::string& name,
+                         std::vector<double> interest_v,
+                         std::vector<double> time_v,
+                         std::shared_ptr<const DistanceOracle> oracle_p,
+                         double eps_t, double eps_d)
+    : size((int)interest_v.size()),
+      interest(std::move(interest_v)),
+      time(std::move(time_v)),
+      epsilon_t(eps_t), epsilon_d(eps_d), filename(name),
+      backend(DistanceBackend::Oracle),
+      oracle(std::move(oracle_p)) {
+    if ((int)time.size() != size || !oracle || oracle->size() != size) {
+        throw std::invalid_argument("Inconsistent instance dimensions: " + name);
+    }
+}
+
+/**
+ * @brief Charge une instance TAP depuis un fichier .dat ou de coordonnées.
  *
  * Lit successivement :
- * 1) le nombre de requêtes (size)
+ * 1) le nombre de requêtes (size), précédé de "coords" pour un fichier de coordonnées
  * 2) la liste des intérêts (interest)
  * 3) la liste des temps (time)
- * 4) la matrice des distances (dist)
+ * 4) la matrice des distances (dist), ou les coordonnées de chaque requête
  *
  * @param filepath Chemin vers le fichier d'instance
+ * @param storage  Représentation de la matrice (Dense ou Compact)
+ * @param budget   Budget mémoire, vérifié avant l'allocation de la matrice (optionnel)
  * @throws std::runtime_error si l'ouverture du fichier échoue
+ * @throws MemoryBudgetExceeded si la matrice ne tient pas dans le budget
  */
-void TapInstance::load_instance(const std::string& filepath) {
+void TapInstance::load_instance(const std::string& filepath, DistanceBackend storage,
+                                const MemoryBudget* budget) {
     std::ifstream infile(filepath);
     if (!infile) {
         throw std::runtime_error("Cannot open file: " + filepath);
     }
 
-    // 1) Nombre de requêtes
-    infile >> size;
+    // 1) Nombre de requêtes (en-tête "coords n dims metric" pour un oracle)
+    std::string first;
+    infile >> first;
+    const bool coords = first == "coords";
+    int dims = 0;
+    std::string metric;
+    if (coords) {
+        infile >> size >> dims >> metric;
+    } else {
+        size = std::stoi(first);
+        // Avant toute allocation en n^2 : Compact ou refus si la matrice dépasse le budget
+        if (budget) storage = budget->choose_storage(size, storage, filepath);
+    }
 
     // 2) Intérêt de chaque requête
     interest.resize(size);
@@ -51,13 +116,105 @@ void TapInstance::load_instance(const std::string& filepath) {
         infile >> time[i];
     }
 
-    // 4) Matrice de distances (size x size)
-    dist.assign(size, std::vector<double>(size));
+    // 4) Coordonnées (oracle) ou matrice de distances (size x size)
+    if (coords) {
+        std::vector<float> features((std::size_t)size * dims);
+        for (float& f : features) infile >> f;
+        if (!infile) throw std::runtime_error("Truncated coordinates: " + filepath);
+        backend = DistanceBackend::Oracle;
+        oracle = std::make_shared<const DistanceOracle>(size, dims, std::move(features),
+                                                        parse_oracle_metric(metric));
+        return;
+    }
+    if (storage == DistanceBackend::Compact) {
+        std::vector<float> values((std::size_t)size * size);
+        for (float& v : values) infile >> v;
+        backend = DistanceBackend::Compact;
+        compact = std::make_shared<const CompactDistanceMatrix>(size, std::move(values));
+        return;
+    }
+    std::vector<std::vector<double>> rows(size, std::vector<double>(size));
     for (int i = 0; i < size; ++i) {
         for (int j = 0; j < size; ++j) {
-            infile >> dist[i][j];
+            infile >> rows[i][j];
         }
     }
+    dist = DistanceMatrix(std::move(rows));
+}
+
+/**
+ * @brief Distance entre deux requêtes, aiguillée selon la représentation.
+ */
+double TapInstance::distance(int a, int b) const {
+    switch (backend) {
+    case DistanceBackend::Compact: return compact->at(a, b);
+    case DistanceBackend::Oracle:  return (*oracle)(a, b);
+    case DistanceBackend::Dense:   break;
+    }
+    return dist[a][b];
+}
+
+/**
+ * @brief Symétrie des distances, selon la représentation.
+ */
+bool TapInstance::symmetric_distances() const {
+    switch (backend) {
+    case DistanceBackend::Compact: return compact->symmetric();
+    case DistanceBackend::Oracle:  return true;
+    case DistanceBackend::Dense:   break;
+    }
+    return dist.symmetric();
+}
+
+/**
+ * @brief Copie dense de l'instance (la matrice est calculée si besoin).
+ */
+TapInstance TapInstance::materialized() const {
+    if (backend == DistanceBackend::Dense) return *this;
+    TapInstance copy(*this);
+    std::vector<std::vector<double>> rows(size, std::vector<double>(size));
+    for (int i = 0; i < size; ++i) {
+        for (int j = 0; j < size; ++j) rows[i][j] = distance(i, j);
+    }
+    copy.dist = DistanceMatrix(std::move(rows));
+    copy.backend = DistanceBackend::Dense;
+    copy.compact.reset();
+    copy.oracle.reset();
+    return copy;
+}
+
+/**
+ * @brief Mémoire occupée par les distances.
+ */
+std::size_t TapInstance::distance_memory_bytes() const {
+    switch (backend) {
+    case DistanceBackend::Compact: return compact->memory_bytes();
+    case DistanceBackend::Oracle:  return oracle->memory_bytes();
+    case DistanceBackend::Dense:   break;
+    }
+    return (std::size_t)size * (size * sizeof(double) + sizeof(std::vector<double>));
+}
+
+/**
+ * @brief Mémoire de chaque structure (même décompte qu'estimate_instance_bytes).
+ */
+InstanceMemory TapInstance::memory_usage() const {
+    InstanceMemory m;
+    m.queries = (interest.capacity() + time.capacity()) * sizeof(double);
+    m.distances = distance_memory_bytes();
+    m.ids = original_id.capacity() * sizeof(int);
+    m.object = sizeof(TapInstance);
+    return m;
+}
+
+/**
+ * @brief Copie l'instance en changeant ses epsilons (matrice partagée).
+ */
+TapInstance TapInstance::with_budgets(double eps_t, double eps_d) const {
+    TapInstance copy(*this);
+    copy.epsilon_t = eps_t;
+    copy.epsilon_d = eps_d;
+    return copy;
 }
 
 /**
@@ -85,11 +242,13 @@ double TapInstance::solution_time(const std::vector<int>& sol) const {
  * @return Distance totale (double)
  */
 double TapInstance::solution_distance(const std::vector<int>& sol) const {
-    double total = 0.0;
-    for (size_t i = 0; i + 1 < sol.size(); ++i) {
-        total += dist[sol[i]][sol[i + 1]];
-    }
-    return total;
+    return visit_distances(*this, [&](const auto& D) {
+        double total = 0.0;
+        for (size_t i = 0; i + 1 < sol.size(); ++i) {
+            total += D(sol[i], sol[i + 1]);
+        }
+        return total;
+    });
 }
 
 /**
@@ -119,6 +278,76 @@ bool TapInstance::is_valid_solution(const std::vector<int>& sol) const {
         && solution_distance(sol) <= epsilon_d;
 }
 
+/**
+ * @brief Applique une renumérotation des requêtes.
+ *
+ * Reconstruit interest, time et les distances dans le nouvel ordre, puis
+ * compose original_id pour pouvoir revenir aux identifiants du fichier.
+ *
+ * @param order Permutation new -> old
+ */
+void TapInstance::apply_permutation(const std::vector<int>& order) {
+    if ((int)order.size() != size) {
+        throw std::invalid_argument("Permutation size mismatch: " + filename);
+    }
+    std::vector<char> seen(size, 0);
+    for (int old : order) {
+        if (old < 0 || old >= size || seen[old]) {
+            throw std::invalid_argument("Invalid permutation: " + filename);
+        }
+        seen[old] = 1;
+    }
+
+    std::vector<double> new_interest(size), new_time(size);
+    std::vector<int> new_original(size);
+    for (int i = 0; i < size; ++i) {
+        const int oi = order[i];
+        new_interest[i] = interest[oi];
+        new_time[i]     = time[oi];
+        new_original[i] = original_id.empty() ? oi : original_id[oi];
+    }
+    switch (backend) {
+    case DistanceBackend::Dense: {
+        std::vector<std::vector<double>> new_dist(size, std::vector<double>(size));
+        for (int i = 0; i < size; ++i) {
+            const std::vector<double>& src = dist[order[i]];
+            std::vector<double>& dst = new_dist[i];
+            for (int j = 0; j < size; ++j) dst[j] = src[order[j]];
+        }
+        dist = DistanceMatrix(std::move(new_dist));
+        break;
+    }
+    case DistanceBackend::Compact: {
+        std::vector<float> values((std::size_t)size * size);
+        for (int i = 0; i < size; ++i) {
+            const float* src = compact->row(order[i]);
+            for (int j = 0; j < size; ++j) values[(std::size_t)i * size + j] = src[order[j]];
+        }
+        compact = std::make_shared<const CompactDistanceMatrix>(size, std::move(values));
+        break;
+    }
+    case DistanceBackend::Oracle:
+        oracle = std::make_shared<const DistanceOracle>(size, oracle->dims(),
+                                                        oracle->permuted_features(order),
+                                                        oracle->metric());
+        break;
+    }
+    interest.swap(new_interest);
+    time.swap(new_time);
+    original_id.swap(new_original);
+}
+
+/**
+ * @brief Traduit une solution vers les identifiants d'origine.
+ */
+std::vector<int> TapInstance::to_original_ids(const std::vector<int>& sol) const {
+    if (original_id.empty()) return sol;
+    std::vector<int> out;
+    out.reserve(sol.size());
+    for (int q : sol) out.push_back(original_id[q]);
+    return out;
+}
+
 /**
  * @brief Affiche un résumé des caractéristiques de l'instance.
  */
@@ -128,6 +357,7 @@ void TapInstance::display_summary() const {
     std::cout << "Size      : " << size           << " queries\n";
     std::cout << "Epsilon T : " << epsilon_t      << "\n";
     std::cout << "Epsilon D : " << epsilon_d      << "\n";
+    std::cout << "Symmetric : " << (symmetric_distances() ? "yes" : "no") << "\n";
 }
 
 /**
@@ -153,8 +383,8 @@ void TapInstance::display_time() const {
  */
 void TapInstance::display_distance_matrix() const {
     std::cout << "Distance matrix:\n";
-    for (const auto& row : dist) {
-        for (double d : row) std::cout << std::setw(6) << d << " ";
+    for (int i = 0; i < size; ++i) {
+        for (int j = 0; j < size; ++j) std::cout << std::setw(6) << distance(i, j) << " ";
         std::cout << "\n";
     }
 }
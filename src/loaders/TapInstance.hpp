@@ -8,6 +8,33 @@
 #include <iostream>
 #include <stdexcept>
 #include <numeric>
+#include <memory>
+#include "loaders/CompactDistanceMatrix.hpp"
+#include "loaders/DistanceMatrix.hpp"
+#include "loaders/DistanceOracle.hpp"
+
+/**
+ * @brief Représentation des distances d'une instance.
+ */
+enum class DistanceBackend {
+    Dense,     ///< DistanceMatrix : n x n doubles (tous les solveurs)
+    Compact,   ///< CompactDistanceMatrix : n x n floats d'un seul bloc
+    Oracle     ///< DistanceOracle : calculées à la demande depuis des coordonnées
+};
+
+struct MemoryBudget;
+
+/**
+ * @brief Mémoire occupée par chaque structure d'une instance (octets).
+ */
+struct InstanceMemory {
+    std::size_t queries = 0;     ///< interest et time
+    std::size_t distances = 0;   ///< Matrice dense (partagée entre copies), compacte ou coordonnées
+    std::size_t ids = 0;         ///< original_id
+    std::size_t object = 0;      ///< L'objet TapInstance lui-même
+
+    std::size_t total() const { return queries + distances + ids + object; }
+};
 
 /**
  * @brief Représente une instance du Travelling Analyst Problem (TAP).
@@ -17,26 +44,112 @@
  *   - l'intérêt, le temps d'exécution, et la matrice de distances
  *   - les contraintes epsilon pour le temps et la distance
  *   - le nom du fichier source
+ *
+ * Les distances sont dans dist (matrice dense, par défaut), dans compact
+ * ou calculées par oracle selon backend. Les solveurs qui acceptent les
+ * trois représentations passent par visit_distances (DistanceProvider.hpp) ;
+ * les autres lisent dist directement et exigent une instance dense.
  */
 class TapInstance {
 public:
     int size;                              ///< Nombre de requêtes dans l'instance
     std::vector<double> interest;         ///< Liste des valeurs d'intérêt pour chaque requête
     std::vector<double> time;             ///< Liste des temps d'exécution pour chaque requête
-    std::vector<std::vector<double>> dist;///< Matrice des distances entre chaque paire de requêtes
+    DistanceMatrix dist;                  ///< Matrice des distances entre chaque paire de requêtes (partagée entre copies)
     double epsilon_t;                     ///< Contrainte de temps maximale (budget)
     double epsilon_d;                     ///< Contrainte de distance maximale (budget)
     std::string filename;                 ///< Chemin du fichier d'instance chargé
+    std::vector<int> original_id;         ///< Identifiant d'origine de chaque requête (vide = identité)
+    DistanceBackend backend = DistanceBackend::Dense;          ///< Représentation des distances
+    std::shared_ptr<const CompactDistanceMatrix> compact;      ///< Distances si backend == Compact
+    std::shared_ptr<const DistanceOracle> oracle;              ///< Distances si backend == Oracle
 
     /**
      * @brief Constructeur principal, charge une instance depuis un fichier.
      *
+     * Un fichier de coordonnées (première ligne "coords n dims metric",
+     * voir write_instance_coords) donne toujours une instance Oracle ; un
+     * fichier .dat est chargé en Dense ou, si demandé, en Compact sans
+     * passer par la matrice de doubles.
+     *
      * @param filepath Chemin vers le fichier d'instance .dat
      * @param eps_t    Contrainte maximale de temps
      * @param eps_d    Contrainte maximale de distance
+     * @param storage  Représentation d'une matrice lue (Dense ou Compact)
+     * @param budget   Si non nul, vérifié avant l'allocation de la matrice
+     *                 (passage en Compact ou refus, voir MemoryBudget)
      * @throws std::runtime_error si le fichier ne peut pas être ouvert ou lu
+     * @throws MemoryBudgetExceeded si l'instance ne tient pas dans le budget
+     */
+    TapInstance(const std::string& filepath, double eps_t, double eps_d,
+                DistanceBackend storage = DistanceBackend::Dense,
+                const MemoryBudget* budget = nullptr);
+
+    /**
+     * @brief Constructeur en mémoire, sans lecture de fichier.
+     *
+     * Utilisé par le générateur d'instances synthétiques pour éviter
+     * un aller-retour disque dans les benchmarks.
+     *
+     * @param name       Nom logique de l'instance (remplace le chemin de fichier)
+     * @param interest_v Valeurs d'intérêt (taille n)
+     * @param time_v     Temps d'exécution (taille n)
+     * @param dist_m     Matrice des distances (n x n)
+     * @param eps_t      Contrainte maximale de temps
+     * @param eps_d      Contrainte maximale de distance
+     * @throws std::invalid_argument si les dimensions sont incohérentes
+     */
+    TapInstance(const std::string& name,
+                std::vector<double> interest_v,
+                std::vector<double> time_v,
+                std::vector<std::vector<double>> dist_m,
+                double eps_t, double eps_d);
+
+    /**
+     * @brief Constructeur en mémoire d'une instance à distances implicites.
+     *
+     * @throws std::invalid_argument si les dimensions sont incohérentes
+     */
+    TapInstance(const std::string& name,
+                std::vector<double> interest_v,
+                std::vector<double> time_v,
+                std::shared_ptr<const DistanceOracle> oracle_p,
+                double eps_t, double eps_d);
+
+    /**
+     * @brief Distance de a à b, quelle que soit la représentation.
+     *
+     * Aiguillage à chaque appel : pour les boucles chaudes, préférer
+     * visit_distances.
+     */
+    double distance(int a, int b) const;
+
+    /**
+     * @brief Copie de l'instance avec une matrice dense (calculée si besoin).
+     *
+     * Permet d'appliquer les solveurs denses à une petite instance Compact
+     * ou Oracle (O(n^2) mémoire).
      */
-    TapInstance(const std::string& filepath, double eps_t, double eps_d);
+    TapInstance materialized() const;
+
+    /// Mémoire occupée par les distances (octets).
+    std::size_t distance_memory_bytes() const;
+
+    /// Mémoire occupée par chaque structure de l'instance.
+    InstanceMemory memory_usage() const;
+
+    /// Distances symétriques (détecté au chargement de la matrice).
+    bool symmetric_distances() const;
+
+    /**
+     * @brief Copie de l'instance avec d'autres epsilons.
+     *
+     * Les distances sont partagées avec l'original (pas de copie n^2).
+     *
+     * @param eps_t Nouvelle contrainte de temps
+     * @param eps_d Nouvelle contrainte de distance
+     */
+    TapInstance with_budgets(double eps_t, double eps_d) const;
 
     /**
      * @brief Calcule le temps total d'une solution donnée.
@@ -74,6 +187,27 @@ public:
      */
     bool is_valid_solution(const std::vector<int>& sol) const;
 
+    /**
+     * @brief Renumérote les requêtes (intérêt, temps et matrice ensemble).
+     *
+     * Après l'appel, la requête i correspond à l'ancienne requête order[i].
+     * Les permutations successives se composent : original_id garde
+     * toujours l'identifiant du fichier d'origine.
+     *
+     * @param order Permutation new -> old de taille size
+     * @throws std::invalid_argument si order n'est pas une permutation
+     */
+    void apply_permutation(const std::vector<int>& order);
+
+    /**
+     * @brief Traduit une solution exprimée sur l'instance renumérotée
+     *        en identifiants du fichier d'origine.
+     *
+     * @param sol Séquence d'indices de requêtes (numérotation courante)
+     * @return La même séquence avec les identifiants d'origine
+     */
+    std::vector<int> to_original_ids(const std::vector<int>& sol) const;
+
     /**
      * @brief Affiche un résumé de l'instance (taille, epsilons, nom de fichier).
      */
@@ -103,8 +237,10 @@ private:
      *
      * @param filepath Chemin vers le fichier .dat
      * @throws std::runtime_error si le fichier ne peut pas être ouvert
+     * @throws MemoryBudgetExceeded si la matrice ne tient pas dans budget
      */
-    void load_instance(const std::string& filepath);
+    void load_instance(const std::string& filepath, DistanceBackend storage,
+                       const MemoryBudget* budget);
 };
 
 #endif // TAP_INSTANCE_HPP
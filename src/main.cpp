@@ -1,16 +1,174 @@
 #include "loaders/TapInstance.hpp"
 #include "solver/GreedySolver.hpp"
+#include "solver/QueryReordering.hpp"
+#include "solver/SolverDispatch.hpp"
+#include "server/SolverServer.hpp"
 #include "loaders/InstanceLoader.hpp"
 #include "loaders/EvaluationLoader.hpp"
+#include "loaders/MemoryBudget.hpp"
+#include "solver/Parallel.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
 #include <iostream>
 #include <iomanip>
+#include <string>
 #include <unistd.h>
 #include <limits.h>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <sys/stat.h>
 #include <unordered_map>
 
+/**
+ * @brief Affiche l'aide de la ligne de commande.
+ */
+static void usage(const char* prog) {
+    std::cerr << "Usage : " << prog << " [options]\n"
+              << "  --perf             compteurs matériels par phase (Linux)\n"
+              << "  --trace FILE       écrit les incumbents horodatés (pour tap_report)\n"
+              << "  --dir DIR          répertoire des instances (défaut instances/)\n"
+              << "  --specs FILE       fichier des epsilons (défaut DIR/baselines.txt)\n"
+              << "  --solver NAME      greedy | decomp | tabu | memetic | portfolio (défaut greedy)\n"
+              << "  --time-limit MS    limite de temps par instance des solveurs itératifs (tabu, memetic, portfolio)\n"
+              << "  --iters N          itérations maximales de tabu\n"
+              << "  --clusters K       nombre de groupes pour decomp (défaut n/400)\n"
+              << "  --threads N        threads pour decomp, memetic, portfolio et reorder (défaut : nb de cœurs)\n"
+              << "  --population P     taille de la population de memetic (défaut 32)\n"
+              << "  --checkpoint DIR   sauvegardes périodiques de tabu / memetic (DIR/<instance>.ckpt)\n"
+              << "  --checkpoint-every S  intervalle entre deux sauvegardes en secondes (défaut 60)\n"
+              << "  --resume           reprend les recherches depuis les checkpoints de DIR\n"
+              << "  --reorder METHOD   none | rcm | nn | cluster : renumérotation au chargement\n"
+              << "  --distances KIND   dense | compact : stockage des matrices .dat (défaut dense)\n"
+              << "  --mem-budget MB    budget mémoire : instance trop grande chargée en compact (decomp)\n"
+              << "                     ou ignorée ; borne aussi les instances résolues en même temps\n"
+              << "  --jobs N           instances résolues en même temps (défaut 1)\n"
+              << "  --serve            mode serveur : requêtes JSON ligne par ligne (stdin)\n"
+              << "  --socket PATH      mode serveur sur une socket Unix\n"
+              << "  --workers N        threads de résolution du serveur (défaut : nb de cœurs)\n"
+              << "  --cache-mb M       mémoire des instances résidentes du serveur (défaut 1024)\n";
+}
+
+/**
+ * @brief Résultat d'une instance du lot.
+ */
+struct InstanceRun {
+    std::string report;       ///< Texte affiché pour l'instance
+    bool solved = false;      ///< Solution calculée (instance ni ignorée ni en erreur)
+    bool fatal = false;       ///< Erreur qui fait échouer l'exécution
+    double interest = 0.0;    ///< Intérêt de la solution
+};
+
+/// Taille lisible : Ko sous 1 Mo, Mo avec une décimale au-delà.
+static std::string format_bytes(std::size_t bytes) {
+    std::ostringstream os;
+    if (bytes < (1u << 20)) {
+        os << (bytes + 1023) / 1024 << " Ko";
+    } else {
+        os << std::fixed << std::setprecision(1) << bytes / (1024.0 * 1024.0) << " Mo";
+    }
+    return os.str();
+}
+
 // main loop
-int main() {
+int main(int argc, char** argv) {
+    bool perf = false;
+    std::string trace_file;
+    std::string instance_directory = "instances/";
+    std::string spec_file;
+    SolveOptions solve_opts;
+    ReorderMethod reorder = ReorderMethod::None;
+    DistanceBackend storage = DistanceBackend::Dense;
+    int threads = 0;
+    int jobs = 1;
+    MemoryBudget budget;
+    bool serve = false;
+    bool dir_given = false;
+    ServerConfig server_cfg;
+    std::string checkpoint_dir;
+    double checkpoint_every_s = 60.0;
+    bool resume = false;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if      (arg == "--perf")     perf = true;
+            else if (arg == "--trace")    trace_file = next();
+            else if (arg == "--dir")      { instance_directory = next() + "/"; dir_given = true; }
+            else if (arg == "--specs")    spec_file = next();
+            else if (arg == "--solver")   solve_opts.kind = parse_solver_kind(next());
+            else if (arg == "--clusters") solve_opts.decomposition.clusters = std::stoi(next());
+            else if (arg == "--threads")  threads = std::stoi(next());
+            else if (arg == "--time-limit") solve_opts.time_limit_ms = std::stod(next());
+            else if (arg == "--iters")    solve_opts.tabu.max_iters = std::stol(next());
+            else if (arg == "--population") solve_opts.memetic.population = std::stoi(next());
+            else if (arg == "--checkpoint") checkpoint_dir = next();
+            else if (arg == "--checkpoint-every") checkpoint_every_s = std::stod(next());
+            else if (arg == "--resume")   resume = true;
+            else if (arg == "--reorder")  reorder = parse_reorder_method(next());
+            else if (arg == "--distances") {
+                std::string kind = next();
+                if      (kind == "dense")   storage = DistanceBackend::Dense;
+                else if (kind == "compact") storage = DistanceBackend::Compact;
+                else throw std::invalid_argument("Unknown distance storage: " + kind);
+            }
+            else if (arg == "--mem-budget") budget.bytes = std::stoull(next()) << 20;
+            else if (arg == "--jobs")     jobs = std::max(1, std::stoi(next()));
+            else if (arg == "--serve")    serve = true;
+            else if (arg == "--socket")   { server_cfg.socket_path = next(); serve = true; }
+            else if (arg == "--workers")  server_cfg.workers = std::stoi(next());
+            else if (arg == "--cache-mb") server_cfg.cache_bytes = std::stoull(next()) << 20;
+            else {
+                std::cerr << "Option inconnue : " << arg << "\n";
+                usage(argv[0]);
+                return 1;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur : " << e.what() << "\n";
+        usage(argv[0]);
+        return 1;
+    }
+    solve_opts.decomposition.threads = threads;
+    solve_opts.memetic.threads = threads;
+    solve_opts.portfolio.threads = threads;
+    // Repli Compact seulement si le solveur l'accepte, sinon l'instance est ignorée
+    budget.allow_compact = solve_opts.kind == SolverKind::Decomposition;
+    if (resume && checkpoint_dir.empty()) {
+        std::cerr << "Erreur : --resume nécessite --checkpoint DIR\n";
+        return 1;
+    }
+    if (!checkpoint_dir.empty() && !solver_supports_checkpoint(solve_opts.kind)) {
+        std::cerr << "Avertissement : --checkpoint ignoré, le solveur "
+                  << solver_kind_name(solve_opts.kind) << " ne sauvegarde pas sa recherche\n";
+        checkpoint_dir.clear();
+    }
+    if (!checkpoint_dir.empty() && mkdir(checkpoint_dir.c_str(), 0755) != 0 && errno != EEXIST) {
+        perror("Erreur mkdir() du répertoire de checkpoints");
+        return 1;
+    }
+
+    if (serve) {
+        // Mode serveur : les instances restent chargées entre les requêtes
+        if (dir_given) server_cfg.instance_dir = instance_directory;
+        return run_server(server_cfg);
+    }
+
+    if (!trace_file.empty()) {
+        // Une trace par exécution : repartir d'un fichier vide
+        std::ofstream(trace_file, std::ios::trunc);
+    }
+    if (perf && !perf_counters_enable()) {
+        std::cerr << "Avertissement : compteurs matériels indisponibles "
+                     "(perf_event_open refusé), mesure du temps seule\n";
+    }
+
     // [Debug only] Affiche le répertoire de travail courant
     char cwd[PATH_MAX];
     if (getcwd(cwd, sizeof(cwd)) != nullptr) {
@@ -20,8 +178,7 @@ int main() {
     }
 
     // paths, doit etre dans graded_lab/...
-    const std::string instance_directory = "instances/";
-    const std::string spec_file = instance_directory + "baselines.txt";
+    if (spec_file.empty()) spec_file = instance_directory + "baselines.txt";
     const std::string baseline_result_file = instance_directory + "baselines_results.txt";
     const std::string optimal_result_file = instance_directory + "opt.txt";
 
@@ -32,26 +189,101 @@ int main() {
     std::unordered_map<std::string, double> greedy_scores;
 
     std::cout << "=== Résolution gloutonne pour chaque instance ===\n";
-    for (const auto& spec : specs) {
+    // Jusqu'à --jobs instances à la fois, admises selon le budget mémoire ;
+    // rapports affichés dans l'ordre des specs dès qu'ils sont prêts
+    MemoryGate gate(budget.bytes);
+    std::mutex print_mutex;
+    auto solve_instance = [&](const InstanceSpec& spec, InstanceRun& run, std::ostream& out) {
         std::string full_path = instance_directory + spec.filename;
+        int n = 0;
+        const std::size_t instance_bytes = estimate_file_bytes(full_path, storage, budget, &n);
+        MemoryReservation reservation(gate, instance_bytes + estimate_solver_bytes(n, solve_opts));
+        if (perf && !perf_counters_active()) perf_counters_enable();
+        const bool own_peak = jobs == 1 && reset_peak_rss();
 
-        // Chargement de l'instance TAP
-        TapInstance instance(full_path, spec.epsilon_time, spec.epsilon_distance);
+        // Chargement de l'instance TAP (Compact ou refus si la matrice dépasse le budget)
+        TapInstance instance(full_path, spec.epsilon_time, spec.epsilon_distance, storage,
+                             &budget);
+        if (reorder != ReorderMethod::None) {
+            // Renumérotation pour la localité ; les ids affichés restent ceux du fichier
+            instance.apply_permutation(compute_locality_order(instance, reorder, threads));
+        }
+        if (instance.backend != DistanceBackend::Dense
+            && solve_opts.kind != SolverKind::Decomposition) {
+            out << "Erreur : " << spec.filename << " n'a pas de matrice dense, "
+                << "seul --solver decomp l'accepte\n";
+            run.fatal = true;
+            return;
+        }
 
-        // Exécution de l'algorithme glouton
-        std::vector<int> solution = greedy_solve(instance);
-        double interest = instance.solution_interest(solution);
-        greedy_scores[spec.filename] = interest;
+        // Exécution du solveur choisi (glouton par défaut)
+        SolverStats stats;
+        IncumbentTrace trace;
+        std::unique_ptr<Checkpointer> checkpoint;
+        if (!checkpoint_dir.empty()) {
+            checkpoint = std::make_unique<Checkpointer>(
+                checkpoint_dir + "/" + spec.filename + ".ckpt", checkpoint_every_s * 1000.0,
+                instance, solver_kind_name(solve_opts.kind), resume);
+        }
+        std::vector<int> solution = run_solver(instance, solve_opts, &stats, &trace,
+                                               checkpoint.get());
+        // Après la résolution : le solveur peut encore refuser le checkpoint
+        if (checkpoint && checkpoint->already_finished()) {
+            out << "Recherche déjà terminée (checkpoint, " << checkpoint->resumed()->elapsed_ms
+                << " ms effectuées) : " << spec.filename << "\n";
+        } else if (checkpoint && checkpoint->resumed()) {
+            out << "Reprise depuis le checkpoint (" << checkpoint->resumed()->elapsed_ms
+                << " ms déjà effectuées) : " << spec.filename << "\n";
+        }
+        if (!trace_file.empty()) {
+            std::lock_guard<std::mutex> lock(print_mutex);
+            append_incumbent_trace(trace_file, spec.filename, trace);
+        }
+        run.interest = instance.solution_interest(solution);
+        run.solved = true;
 
         // Affichage des résultats pour l'instance
-        std::cout << "Instance : " << spec.filename << "\n";
-        std::cout << "  Solution valide     : " << std::boolalpha << instance.is_valid_solution(solution) << "\n";
-        std::cout << "  Intérêt total       : " << interest << "\n";
-        std::cout << "  Temps total         : " << instance.solution_time(solution) << "\n";
-        std::cout << "  Distance totale     : " << instance.solution_distance(solution) << "\n";
-        std::cout << "  Séquence sélectionnée : ";
-        for (int id : solution) std::cout << id << " ";
-        std::cout << "\n\n";
+        const InstanceMemory mem = instance.memory_usage();
+        out << "Instance : " << spec.filename << "\n";
+        out << "  Solution valide     : " << std::boolalpha << instance.is_valid_solution(solution) << "\n";
+        out << "  Intérêt total       : " << run.interest << "\n";
+        stats.print(out, "  ");
+        out << "  Mémoire instance    : " << format_bytes(mem.total()) << " (distances "
+            << format_bytes(mem.distances) << ", requêtes " << format_bytes(mem.queries + mem.ids)
+            << "), mémoire du solveur " << format_bytes(stats.workspace_bytes) << "\n";
+        out << "  Pic RSS             : " << format_bytes(peak_rss_bytes())
+            << (own_peak ? "" : " (processus)") << "\n";
+        out << "  Temps total         : " << instance.solution_time(solution) << "\n";
+        out << "  Distance totale     : " << instance.solution_distance(solution) << "\n";
+        out << "  Séquence sélectionnée : ";
+        for (int id : instance.to_original_ids(solution)) out << id << " ";
+        out << "\n\n";
+    };
+
+    std::vector<InstanceRun> runs(specs.size());
+    std::vector<char> done(specs.size(), 0);
+    std::size_t next_print = 0;
+    parallel_for((int)specs.size(), jobs, [&](int k) {
+        std::ostringstream out;
+        try {
+            solve_instance(specs[k], runs[k], out);
+        } catch (const MemoryBudgetExceeded& e) {
+            out << "Avertissement : instance ignorée, " << e.what() << "\n\n";
+        } catch (const std::exception& e) {
+            out << "Erreur : " << specs[k].filename << " : " << e.what() << "\n";
+            runs[k].fatal = true;
+        }
+        runs[k].report = out.str();
+
+        std::lock_guard<std::mutex> lock(print_mutex);
+        done[k] = 1;
+        while (next_print < specs.size() && done[next_print]) {
+            std::cout << runs[next_print++].report << std::flush;
+        }
+    });
+    for (std::size_t k = 0; k < specs.size(); ++k) {
+        if (runs[k].fatal) return 1;
+        if (runs[k].solved) greedy_scores[specs[k].filename] = runs[k].interest;
     }
 
     // Comparaison finale avec baseline et optima connus
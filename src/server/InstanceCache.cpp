@@ -0,0 +1,79 @@
+#include "server/InstanceCache.hpp"
+#include "loaders/MemoryBudget.hpp"
+
+/**
+ * @file InstanceCache.cpp
+ * @brief Cache LRU des instances résidentes du serveur
+ */
+
+std::size_t InstanceCache::estimate_bytes(const TapInstance& I) {
+    return I.memory_usage().total();
+}
+
+std::shared_ptr<const TapInstance> InstanceCache::get(const std::string& path, bool* hit) {
+    std::promise<std::shared_ptr<const TapInstance>> promise;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto it = index_.find(path);
+        if (it != index_.end()) {
+            lru_.splice(lru_.begin(), lru_, it->second);
+            if (hit) *hit = true;
+            return it->second->second.instance;
+        }
+        auto pending = loading_.find(path);
+        if (pending != loading_.end()) {
+            // Un autre thread charge déjà ce fichier : attendre son résultat
+            auto fut = pending->second;
+            lock.unlock();
+            if (hit) *hit = true;
+            return fut.get();
+        }
+        loading_[path] = promise.get_future().share();
+    }
+    if (hit) *hit = false;
+
+    // Chargement hors verrou : les autres fichiers restent servis
+    std::shared_ptr<const TapInstance> inst;
+    try {
+        // Une instance plus grande que tout le cache est refusée avant d'allouer sa matrice
+        // (pas de repli Compact : les requêtes greedy, tabu... exigent une matrice dense)
+        MemoryBudget budget{capacity_, false};
+        inst = std::make_shared<const TapInstance>(path, 0.0, 0.0, DistanceBackend::Dense,
+                                                   &budget);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        promise.set_exception(std::current_exception());
+        loading_.erase(path);
+        throw;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry e{inst, estimate_bytes(*inst)};
+    lru_.emplace_front(path, e);
+    index_[path] = lru_.begin();
+    resident_ += e.bytes;
+    evict_locked();
+    promise.set_value(inst);
+    loading_.erase(path);
+    return inst;
+}
+
+void InstanceCache::evict_locked() {
+    // Toujours garder l'instance la plus récente, même si elle dépasse seule le budget
+    while (resident_ > capacity_ && lru_.size() > 1) {
+        auto& victim = lru_.back();
+        resident_ -= victim.second.bytes;
+        index_.erase(victim.first);
+        lru_.pop_back();
+    }
+}
+
+std::size_t InstanceCache::resident_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return resident_;
+}
+
+std::size_t InstanceCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lru_.size();
+}
@@ -0,0 +1,66 @@
+#ifndef INSTANCE_CACHE_HPP
+#define INSTANCE_CACHE_HPP
+
+#include "loaders/TapInstance.hpp"
+#include <cstddef>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief Cache LRU des instances chargées, borné en mémoire.
+ *
+ * Les instances sont indexées par chemin de fichier et chargées sans
+ * epsilons : chaque requête en dérive une copie avec ses propres budgets
+ * (TapInstance::with_budgets, matrice partagée). Une instance en cours
+ * d'utilisation reste valide après éviction grâce au shared_ptr.
+ *
+ * Plusieurs demandes simultanées du même fichier absent ne déclenchent
+ * qu'un seul chargement.
+ */
+class InstanceCache {
+public:
+    /**
+     * @param capacity_bytes Mémoire maximale des instances résidentes
+     */
+    explicit InstanceCache(std::size_t capacity_bytes) : capacity_(capacity_bytes) {}
+
+    /**
+     * @brief Renvoie l'instance du fichier, en la chargeant si besoin.
+     *
+     * @param path Chemin du fichier .dat
+     * @param hit  Mis à true si l'instance était déjà résidente
+     * @throws std::runtime_error si le fichier ne peut pas être chargé
+     */
+    std::shared_ptr<const TapInstance> get(const std::string& path, bool* hit = nullptr);
+
+    /// Mémoire occupée par les instances résidentes (octets).
+    std::size_t resident_bytes() const;
+
+    /// Nombre d'instances résidentes.
+    std::size_t size() const;
+
+    /// Estimation de la mémoire occupée par une instance (octets).
+    static std::size_t estimate_bytes(const TapInstance& instance);
+
+private:
+    struct Entry {
+        std::shared_ptr<const TapInstance> instance;
+        std::size_t bytes;
+    };
+    using LruList = std::list<std::pair<std::string, Entry>>;
+
+    void evict_locked();
+
+    std::size_t capacity_;
+    std::size_t resident_ = 0;
+    mutable std::mutex mutex_;
+    LruList lru_;   ///< Plus récemment utilisée en tête
+    std::unordered_map<std::string, LruList::iterator> index_;
+    std::unordered_map<std::string, std::shared_future<std::shared_ptr<const TapInstance>>> loading_;
+};
+
+#endif // INSTANCE_CACHE_HPP
@@ -0,0 +1,208 @@
+#include "server/JsonLine.hpp"
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+/**
+ * @file JsonLine.cpp
+ * @brief Lecture et écriture des objets JSON plats du protocole ligne par ligne
+ */
+
+namespace {
+
+/**
+ * @brief Analyseur récursif minimal sur une ligne.
+ */
+class Parser {
+public:
+    explicit Parser(const std::string& s) : s_(s) {}
+
+    JsonObject object() {
+        JsonObject obj;
+        skip_ws();
+        expect('{');
+        skip_ws();
+        if (peek() == '}') { ++pos_; return finish(obj); }
+        while (true) {
+            skip_ws();
+            std::string k = string();
+            skip_ws();
+            expect(':');
+            skip_ws();
+            obj[k] = scalar();
+            skip_ws();
+            if (peek() == ',') { ++pos_; continue; }
+            expect('}');
+            return finish(obj);
+        }
+    }
+
+private:
+    JsonObject finish(JsonObject& obj) {
+        skip_ws();
+        if (pos_ != s_.size()) fail("trailing characters");
+        return obj;
+    }
+
+    JsonScalar scalar() {
+        JsonScalar v;
+        char c = peek();
+        if (c == '"') {
+            v.type = JsonScalar::Type::String;
+            v.text = string();
+        } else if (c == 't' || c == 'f' || c == 'n') {
+            if (s_.compare(pos_, 4, "true") == 0)       { v.type = JsonScalar::Type::Bool; v.number = 1; pos_ += 4; }
+            else if (s_.compare(pos_, 5, "false") == 0) { v.type = JsonScalar::Type::Bool; v.number = 0; pos_ += 5; }
+            else if (s_.compare(pos_, 4, "null") == 0)  { v.type = JsonScalar::Type::Null; pos_ += 4; }
+            else fail("unexpected literal");
+        } else if (c == '-' || std::isdigit((unsigned char)c)) {
+            const char* begin = s_.c_str() + pos_;
+            char* end = nullptr;
+            v.type = JsonScalar::Type::Number;
+            v.number = std::strtod(begin, &end);
+            if (end == begin) fail("invalid number");
+            pos_ += (size_t)(end - begin);
+        } else {
+            fail("only flat objects with scalar values are supported");
+        }
+        return v;
+    }
+
+    std::string string() {
+        expect('"');
+        std::string out;
+        while (pos_ < s_.size() && s_[pos_] != '"') {
+            char c = s_[pos_++];
+            if (c != '\\') { out += c; continue; }
+            if (pos_ >= s_.size()) fail("unterminated escape");
+            char e = s_[pos_++];
+            switch (e) {
+            case 'n': out += '\n'; break;
+            case 't': out += '\t'; break;
+            case 'r': out += '\r'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'u': {
+                if (pos_ + 4 > s_.size()) fail("short \\u escape");
+                unsigned cp = (unsigned)std::stoul(s_.substr(pos_, 4), nullptr, 16);
+                pos_ += 4;
+                // Encodage UTF-8 (plan multilingue de base uniquement)
+                if (cp < 0x80) out += (char)cp;
+                else if (cp < 0x800) { out += (char)(0xC0 | (cp >> 6)); out += (char)(0x80 | (cp & 0x3F)); }
+                else { out += (char)(0xE0 | (cp >> 12)); out += (char)(0x80 | ((cp >> 6) & 0x3F));
+                       out += (char)(0x80 | (cp & 0x3F)); }
+                break;
+            }
+            default: out += e; break;  // \" \\ \/
+            }
+        }
+        expect('"');
+        return out;
+    }
+
+    char peek() const { return pos_ < s_.size() ? s_[pos_] : '\0'; }
+    void skip_ws() { while (pos_ < s_.size() && std::isspace((unsigned char)s_[pos_])) ++pos_; }
+    void expect(char c) {
+        if (peek() != c) fail(std::string("expected '") + c + "'");
+        ++pos_;
+    }
+    [[noreturn]] void fail(const std::string& what) const {
+        throw std::invalid_argument("JSON: " + what + " at column " + std::to_string(pos_));
+    }
+
+    const std::string& s_;
+    size_t pos_ = 0;
+};
+
+} // namespace
+
+JsonObject parse_json_line(const std::string& line) {
+    return Parser(line).object();
+}
+
+std::string json_escape(const std::string& s) {
+    std::string out;
+    out.reserve(s.size() + 2);
+    for (char c : s) {
+        switch (c) {
+        case '"':  out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n";  break;
+        case '\r': out += "\\r";  break;
+        case '\t': out += "\\t";  break;
+        default:
+            if ((unsigned char)c < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", (unsigned)c);
+                out += buf;
+            } else {
+                out += c;
+            }
+        }
+    }
+    return out;
+}
+
+std::string json_scalar_to_string(const JsonScalar& v) {
+    switch (v.type) {
+    case JsonScalar::Type::String: return "\"" + json_escape(v.text) + "\"";
+    case JsonScalar::Type::Bool:   return v.number != 0 ? "true" : "false";
+    case JsonScalar::Type::Null:   return "null";
+    case JsonScalar::Type::Number: {
+        std::ostringstream oss;
+        oss.precision(17);
+        oss << v.number;
+        return oss.str();
+    }
+    }
+    return "null";
+}
+
+void JsonWriter::key(const std::string& k) {
+    if (!body_.empty()) body_ += ",";
+    body_ += "\"" + json_escape(k) + "\":";
+}
+
+JsonWriter& JsonWriter::field(const std::string& k, const std::string& value) {
+    key(k);
+    body_ += "\"" + json_escape(value) + "\"";
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const std::string& k, const char* value) {
+    return field(k, std::string(value));
+}
+
+JsonWriter& JsonWriter::field(const std::string& k, double value) {
+    JsonScalar v;
+    v.type = JsonScalar::Type::Number;
+    v.number = value;
+    key(k);
+    body_ += json_scalar_to_string(v);
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const std::string& k, bool value) {
+    key(k);
+    body_ += value ? "true" : "false";
+    return *this;
+}
+
+JsonWriter& JsonWriter::field(const std::string& k, const std::vector<int>& values) {
+    key(k);
+    body_ += "[";
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i) body_ += ",";
+        body_ += std::to_string(values[i]);
+    }
+    body_ += "]";
+    return *this;
+}
+
+JsonWriter& JsonWriter::raw(const std::string& k, const std::string& json) {
+    key(k);
+    body_ += json;
+    return *this;
+}
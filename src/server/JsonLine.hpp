@@ -0,0 +1,63 @@
+#ifndef JSON_LINE_HPP
+#define JSON_LINE_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Valeur scalaire d'un objet JSON plat (une requête du serveur).
+ */
+struct JsonScalar {
+    enum class Type { String, Number, Bool, Null };
+    Type type = Type::Null;
+    std::string text;     ///< Valeur si String
+    double number = 0.0;  ///< Valeur si Number (ou Bool : 0/1)
+};
+
+using JsonObject = std::unordered_map<std::string, JsonScalar>;
+
+/**
+ * @brief Analyse une ligne contenant un objet JSON plat.
+ *
+ * Seuls les objets dont les valeurs sont des chaînes, nombres, booléens
+ * ou null sont acceptés : c'est tout ce que le protocole du serveur utilise.
+ *
+ * @param line Ligne à analyser
+ * @return L'objet analysé
+ * @throws std::invalid_argument si la ligne n'est pas un objet plat valide
+ */
+JsonObject parse_json_line(const std::string& line);
+
+/**
+ * @brief Construit incrémentalement un objet JSON sur une ligne.
+ */
+class JsonWriter {
+public:
+    JsonWriter& field(const std::string& key, const std::string& value);
+    JsonWriter& field(const std::string& key, const char* value);
+    JsonWriter& field(const std::string& key, double value);
+    JsonWriter& field(const std::string& key, bool value);
+    JsonWriter& field(const std::string& key, const std::vector<int>& values);
+    /// Insère une valeur déjà sérialisée (ex. un id recopié tel quel).
+    JsonWriter& raw(const std::string& key, const std::string& json);
+
+    /// Objet terminé, sans saut de ligne.
+    std::string str() const { return "{" + body_ + "}"; }
+
+private:
+    void key(const std::string& k);
+    std::string body_;
+};
+
+/**
+ * @brief Sérialise une valeur scalaire en JSON.
+ */
+std::string json_scalar_to_string(const JsonScalar& v);
+
+/**
+ * @brief Échappe une chaîne pour l'écrire entre guillemets.
+ */
+std::string json_escape(const std::string& s);
+
+#endif // JSON_LINE_HPP
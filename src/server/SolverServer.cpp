@@ -0,0 +1,357 @@
+#include "server/SolverServer.hpp"
+#include "server/InstanceCache.hpp"
+#include "server/JsonLine.hpp"
+#include "loaders/MemoryBudget.hpp"
+#include "solver/Parallel.hpp"
+#include "solver/SolverDispatch.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/**
+ * @file SolverServer.cpp
+ * @brief Serveur résident : cache d'instances, pool de résolution et déduplication
+ */
+
+namespace {
+
+/**
+ * @brief Destination des réponses : stdout ou une connexion socket.
+ *
+ * Les réponses d'une même connexion sont écrites sous verrou, une ligne
+ * complète à la fois. Le descripteur est fermé à la destruction, une fois
+ * toutes les réponses en attente envoyées.
+ */
+class Connection {
+public:
+    explicit Connection(int fd) : fd_(fd) {}
+    ~Connection() { if (fd_ >= 0) close(fd_); }
+
+    void send_line(const std::string& line) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (fd_ < 0) {
+            std::cout << line << "\n" << std::flush;
+            return;
+        }
+        std::string buf = line + "\n";
+        size_t off = 0;
+        while (off < buf.size()) {
+            ssize_t w = ::send(fd_, buf.data() + off, buf.size() - off, MSG_NOSIGNAL);
+            if (w <= 0) return;  // client parti : réponse abandonnée
+            off += (size_t)w;
+        }
+    }
+
+private:
+    int fd_;
+    std::mutex mutex_;
+};
+
+/**
+ * @brief Destinataire d'une réponse : connexion + id de la requête.
+ */
+struct Waiter {
+    std::shared_ptr<Connection> conn;
+    std::string id_json;
+};
+
+/**
+ * @brief Requête de résolution validée.
+ */
+struct SolveJob {
+    std::string key;         ///< Clé de déduplication
+    std::string instance;    ///< Chemin du fichier .dat
+    double eps_t = 0.0;
+    double eps_d = 0.0;
+    SolveOptions opts;
+};
+
+class SolverServer {
+public:
+    explicit SolverServer(const ServerConfig& cfg) : cfg_(cfg), cache_(cfg.cache_bytes) {
+        int n = resolve_thread_count(cfg.workers);
+        for (int i = 0; i < n; ++i) workers_.emplace_back([this] { worker_loop(); });
+    }
+
+    ~SolverServer() { shutdown(); }
+
+    /// Traite une ligne reçue sur une connexion.
+    void handle_line(const std::shared_ptr<Connection>& conn, const std::string& line) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) return;
+        std::string id_json = "null";
+        try {
+            JsonObject req = parse_json_line(line);
+            auto id = req.find("id");
+            if (id != req.end()) id_json = json_scalar_to_string(id->second);
+
+            std::string op = string_field(req, "op", "solve");
+            if (op == "stats") {
+                conn->send_line(stats_json(id_json));
+                return;
+            }
+            if (op != "solve") throw std::invalid_argument("unknown op: " + op);
+
+            SolveJob job = make_job(req);
+            submit(std::move(job), Waiter{conn, id_json});
+        } catch (const std::exception& e) {
+            conn->send_line(JsonWriter().raw("id", id_json)
+                                        .field("status", "error")
+                                        .field("message", e.what()).str());
+        }
+    }
+
+    /// Attend la fin de toutes les requêtes puis arrête les workers.
+    void shutdown() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            idle_.wait(lock, [this] { return queue_.empty() && running_ == 0; });
+            stopping_ = true;
+        }
+        ready_.notify_all();
+        for (auto& t : workers_) if (t.joinable()) t.join();
+        workers_.clear();
+    }
+
+private:
+    static std::string string_field(const JsonObject& req, const std::string& k,
+                                    const std::string& def) {
+        auto it = req.find(k);
+        if (it == req.end() || it->second.type == JsonScalar::Type::Null) return def;
+        if (it->second.type != JsonScalar::Type::String) {
+            throw std::invalid_argument("field '" + k + "' must be a string");
+        }
+        return it->second.text;
+    }
+
+    static double number_field(const JsonObject& req, const std::string& k, double def,
+                               bool required) {
+        auto it = req.find(k);
+        if (it == req.end() || it->second.type == JsonScalar::Type::Null) {
+            if (required) throw std::invalid_argument("missing field '" + k + "'");
+            return def;
+        }
+        if (it->second.type != JsonScalar::Type::Number) {
+            throw std::invalid_argument("field '" + k + "' must be a number");
+        }
+        return it->second.number;
+    }
+
+    SolveJob make_job(const JsonObject& req) const {
+        SolveJob job;
+        job.instance = string_field(req, "instance", "");
+        if (job.instance.empty()) throw std::invalid_argument("missing field 'instance'");
+        std::filesystem::path path(job.instance);
+        if (!cfg_.instance_dir.empty() && path.is_relative()) {
+            path = std::filesystem::path(cfg_.instance_dir) / path;
+        }
+        // Chemin normalisé : clé du cache et de la déduplication ("dir//f" == "dir/./f" == "dir/f")
+        job.instance = path.lexically_normal().string();
+        job.eps_t = number_field(req, "epsilon_time", 0.0, true);
+        job.eps_d = number_field(req, "epsilon_distance", 0.0, true);
+        job.opts.kind = parse_solver_kind(string_field(req, "solver", "greedy"));
+        job.opts.time_limit_ms = number_field(req, "time_limit_ms", 0.0, false);
+        job.opts.decomposition.clusters = (int)number_field(req, "clusters", 0.0, false);
+        // Une seule résolution à la fois par worker : pas de sur-parallélisme interne
+        job.opts.decomposition.threads = 1;
+        job.opts.memetic.threads = 1;
+        job.opts.portfolio.threads = 1;
+
+        std::ostringstream key;
+        key.precision(17);
+        key << job.instance << '|' << job.eps_t << '|' << job.eps_d << '|'
+            << solver_kind_name(job.opts.kind) << '|' << job.opts.time_limit_ms << '|'
+            << job.opts.decomposition.clusters;
+        job.key = key.str();
+        return job;
+    }
+
+    void submit(SolveJob job, Waiter waiter) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = inflight_.find(job.key);
+        if (it != inflight_.end()) {
+            // Requête identique en cours : partager son résultat
+            it->second.push_back(std::move(waiter));
+            ++deduplicated_;
+            return;
+        }
+        inflight_[job.key].push_back(std::move(waiter));
+        queue_.push_back(std::move(job));
+        ready_.notify_one();
+    }
+
+    void worker_loop() {
+        while (true) {
+            SolveJob job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+                if (queue_.empty()) return;
+                job = std::move(queue_.front());
+                queue_.pop_front();
+                ++running_;
+            }
+
+            std::string body = execute(job);
+
+            std::vector<Waiter> waiters;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                waiters = std::move(inflight_[job.key]);
+                inflight_.erase(job.key);
+                ++completed_;
+            }
+            for (size_t i = 0; i < waiters.size(); ++i) {
+                std::string line = "{\"id\":" + waiters[i].id_json + "," + body
+                                 + ",\"deduplicated\":" + (i ? "true" : "false") + "}";
+                waiters[i].conn->send_line(line);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --running_;
+            }
+            idle_.notify_all();
+        }
+    }
+
+    /// Exécute une requête ; renvoie les champs de réponse (sans accolades ni id).
+    std::string execute(const SolveJob& job) {
+        JsonWriter w;
+        try {
+            auto start = std::chrono::steady_clock::now();
+            bool hit = false;
+            std::shared_ptr<const TapInstance> base = cache_.get(job.instance, &hit);
+            TapInstance inst = base->with_budgets(job.eps_t, job.eps_d);
+            std::vector<int> sol = run_solver(inst, job.opts);
+            double ms = std::chrono::duration<double, std::milli>(
+                            std::chrono::steady_clock::now() - start).count();
+            w.field("status", "ok")
+             .field("sequence", inst.to_original_ids(sol))
+             .field("interest", inst.solution_interest(sol))
+             .field("time", inst.solution_time(sol))
+             .field("distance", inst.solution_distance(sol))
+             .field("valid", inst.is_valid_solution(sol))
+             .field("solve_ms", ms)
+             .field("cache_hit", hit);
+        } catch (const std::exception& e) {
+            w = JsonWriter();
+            w.field("status", "error").field("message", e.what());
+        }
+        std::string s = w.str();
+        return s.substr(1, s.size() - 2);
+    }
+
+    std::string stats_json(const std::string& id_json) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return JsonWriter().raw("id", id_json)
+                           .field("status", "ok")
+                           .field("cached_instances", (double)cache_.size())
+                           .field("cache_bytes", (double)cache_.resident_bytes())
+                           .field("cache_capacity", (double)cfg_.cache_bytes)
+                           .field("rss_bytes", (double)current_rss_bytes())
+                           .field("peak_rss_bytes", (double)peak_rss_bytes())
+                           .field("queued", (double)queue_.size())
+                           .field("running", (double)running_)
+                           .field("completed", (double)completed_)
+                           .field("deduplicated", (double)deduplicated_).str();
+    }
+
+    ServerConfig cfg_;
+    InstanceCache cache_;
+
+    std::mutex mutex_;
+    std::condition_variable ready_;   ///< Travail disponible ou arrêt
+    std::condition_variable idle_;    ///< Une requête vient de se terminer
+    std::deque<SolveJob> queue_;
+    std::unordered_map<std::string, std::vector<Waiter>> inflight_;
+    int running_ = 0;
+    bool stopping_ = false;
+    std::size_t completed_ = 0;
+    std::size_t deduplicated_ = 0;
+    std::vector<std::thread> workers_;
+};
+
+/// Lit une connexion socket ligne par ligne jusqu'à sa fermeture.
+void serve_connection(SolverServer& server, int fd) {
+    auto conn = std::make_shared<Connection>(fd);
+    std::string pending;
+    char buf[4096];
+    while (true) {
+        ssize_t r = ::recv(fd, buf, sizeof(buf), 0);
+        if (r <= 0) break;
+        pending.append(buf, (size_t)r);
+        size_t nl;
+        while ((nl = pending.find('\n')) != std::string::npos) {
+            server.handle_line(conn, pending.substr(0, nl));
+            pending.erase(0, nl + 1);
+        }
+    }
+    if (!pending.empty()) server.handle_line(conn, pending);
+    ::shutdown(fd, SHUT_RD);
+}
+
+int serve_socket(SolverServer& server, const std::string& path) {
+    int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        std::perror("socket");
+        return 1;
+    }
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) {
+        std::cerr << "Erreur : chemin de socket trop long '" << path << "'\n";
+        close(listener);
+        return 1;
+    }
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    ::unlink(path.c_str());
+    if (::bind(listener, (sockaddr*)&addr, sizeof(addr)) < 0 || ::listen(listener, 64) < 0) {
+        std::perror("bind/listen");
+        close(listener);
+        return 1;
+    }
+    std::cerr << "Serveur en écoute sur " << path << "\n";
+    while (true) {
+        int fd = ::accept(listener, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            std::perror("accept");
+            break;
+        }
+        std::thread(serve_connection, std::ref(server), fd).detach();
+    }
+    close(listener);
+    return 1;
+}
+
+} // namespace
+
+int run_server(const ServerConfig& cfg) {
+    std::signal(SIGPIPE, SIG_IGN);
+    SolverServer server(cfg);
+    if (!cfg.socket_path.empty()) {
+        return serve_socket(server, cfg.socket_path);
+    }
+    auto out = std::make_shared<Connection>(-1);
+    std::string line;
+    while (std::getline(std::cin, line)) server.handle_line(out, line);
+    server.shutdown();
+    return 0;
+}
@@ -0,0 +1,46 @@
+#ifndef SOLVER_SERVER_HPP
+#define SOLVER_SERVER_HPP
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Paramètres du mode serveur (tap_solver --serve).
+ */
+struct ServerConfig {
+    int workers = 0;                          ///< Threads de résolution (0 = nombre de cœurs)
+    std::size_t cache_bytes = 1ull << 30;     ///< Mémoire maximale des instances résidentes
+    std::string socket_path;                  ///< Socket Unix à écouter (vide = stdin/stdout)
+    std::string instance_dir;                 ///< Préfixe des chemins d'instance relatifs
+};
+
+/**
+ * @brief Lance le serveur de résolution résident.
+ *
+ * Protocole : une requête JSON par ligne, une réponse JSON par ligne.
+ *
+ * Requête :
+ *     {"id": 1, "instance": "tap_14_400.dat", "epsilon_time": 6600,
+ *      "epsilon_distance": 540, "solver": "greedy", "time_limit_ms": 1000}
+ * Réponse :
+ *     {"id": 1, "status": "ok", "sequence": [...], "interest": ...,
+ *      "time": ..., "distance": ..., "valid": true, "solve_ms": ...,
+ *      "cache_hit": true, "deduplicated": false}
+ * {"op": "stats"} renvoie l'état du cache et des files d'attente.
+ *
+ * Les instances restent chargées dans un cache LRU borné en mémoire ;
+ * les requêtes s'exécutent en parallèle sur un pool de threads et une
+ * requête identique à une requête en cours (même instance, epsilons,
+ * solveur et limite de temps) reçoit le résultat de cette dernière sans
+ * nouvelle résolution. Les réponses peuvent arriver dans le désordre :
+ * le champ "id" est recopié tel quel.
+ *
+ * En mode stdin, le serveur s'arrête à la fin de l'entrée après avoir
+ * répondu à toutes les requêtes. En mode socket, il tourne indéfiniment.
+ *
+ * @param cfg Paramètres du serveur
+ * @return Code de sortie du processus
+ */
+int run_server(const ServerConfig& cfg);
+
+#endif // SOLVER_SERVER_HPP
@@ -0,0 +1,63 @@
+#include "solver/CandidatePool.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+/**
+ * @file CandidatePool.cpp
+ * @brief Tableau dense des candidates et retrait par budget de temps
+ */
+
+void CandidatePool::reset(const TapInstance& I, int paths) {
+    if (paths < 1 || paths > kMaxPaths) {
+        throw std::invalid_argument("CandidatePool: path count out of range");
+    }
+    I_ = &I;
+    ids_.resize(I.size);
+    slot_.resize(I.size);
+    by_time_.resize(I.size);
+    cursor_.assign(paths, 0);
+    std::iota(ids_.begin(), ids_.end(), 0);
+    std::iota(slot_.begin(), slot_.end(), 0);
+    mask_.assign(I.size, (std::uint8_t)((1u << paths) - 1));
+    std::iota(by_time_.begin(), by_time_.end(), 0);
+    std::sort(by_time_.begin(), by_time_.end(), [&](int a, int b) {
+        return I.time[a] > I.time[b];
+    });
+}
+
+void CandidatePool::drop(int q, int path) {
+    if (!live(q, path)) return;
+    mask_[q] &= (std::uint8_t)~(1u << path);
+    if (mask_[q] != 0) return;
+    // Plus candidate nulle part : échange avec la dernière
+    int at = slot_[q];
+    int last = ids_.back();
+    ids_[at] = last;
+    slot_[last] = at;
+    ids_.pop_back();
+    slot_[q] = -1;
+}
+
+void CandidatePool::drop_all(int path) {
+    // Parcours à rebours : l'échange ne ramène que des indices déjà vus
+    for (std::size_t i = ids_.size(); i-- > 0;) {
+        drop(ids_[i], path);
+    }
+    cursor_[path] = I_->size;
+}
+
+int CandidatePool::retire_over_time(int path, double time) {
+    int retired = 0;
+    int& c = cursor_[path];
+    // Même test que feasible() : time + t_q <= epsilon_t
+    while (c < I_->size && time + I_->time[by_time_[c]] > I_->epsilon_t) {
+        int q = by_time_[c++];
+        if (live(q, path)) {
+            drop(q, path);
+            ++retired;
+        }
+    }
+    return retired;
+}
@@ -0,0 +1,84 @@
+#ifndef CANDIDATE_POOL_HPP
+#define CANDIDATE_POOL_HPP
+
+#include "loaders/TapInstance.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Requêtes encore insérables dans une ou plusieurs trajectoires en construction.
+ *
+ * Les requêtes candidates pour au moins une trajectoire sont rangées dans
+ * un tableau dense : en retirer une l'échange avec la dernière (O(1)), et
+ * les boucles d'insertion ne parcourent que ce tableau. Un masque par
+ * requête indique les trajectoires pour lesquelles elle est candidate.
+ *
+ * Un index des requêtes par temps décroissant retire en bloc, pour une
+ * trajectoire, celles qui ne tiennent plus dans le budget de temps : le
+ * temps cumulé ne fait que croître pendant l'insertion, le retrait est
+ * définitif et le curseur de l'index ne recule jamais (O(n) au total par
+ * trajectoire).
+ */
+class CandidatePool {
+public:
+    /// Nombre maximal de trajectoires (bits du masque).
+    static constexpr int kMaxPaths = 8;
+
+    /// Pool vide, à préparer par reset() (tampons réutilisables, SolverWorkspace).
+    CandidatePool() = default;
+
+    /**
+     * @param I     Instance (temps et epsilon_t ; doit survivre au pool)
+     * @param paths Nombre de trajectoires (1 à kMaxPaths), toutes les requêtes candidates
+     * @throws std::invalid_argument si paths est hors bornes
+     */
+    CandidatePool(const TapInstance& I, int paths) { reset(I, paths); }
+
+    /**
+     * @brief Repart de toutes les requêtes de I, candidates pour paths trajectoires.
+     *
+     * Réutilise la capacité des tableaux : aucune allocation si I n'est pas
+     * plus grande que les instances précédentes.
+     *
+     * @throws std::invalid_argument si paths est hors bornes
+     */
+    void reset(const TapInstance& I, int paths);
+
+    /// Requêtes candidates pour au moins une trajectoire (ordre quelconque).
+    const std::vector<int>& ids() const { return ids_; }
+
+    /// q est-elle candidate pour la trajectoire path ?
+    bool live(int q, int path) const { return (mask_[q] >> path) & 1u; }
+
+    /// Retire q des candidates de la trajectoire path (insérée ou infaisable).
+    void drop(int q, int path);
+
+    /// Retire toutes les candidates de la trajectoire path (construction terminée).
+    void drop_all(int path);
+
+    /**
+     * @brief Retire de la trajectoire path les requêtes q telles que time + t_q > epsilon_t.
+     *
+     * @param path Trajectoire
+     * @param time Temps cumulé de la trajectoire (croissant d'un appel à l'autre)
+     * @return Nombre de candidates retirées par cet appel
+     */
+    int retire_over_time(int path, double time);
+
+    /// Octets réservés par les tableaux.
+    std::size_t capacity_bytes() const {
+        return (ids_.capacity() + slot_.capacity() + by_time_.capacity() + cursor_.capacity())
+                   * sizeof(int)
+             + mask_.capacity();
+    }
+
+private:
+    const TapInstance* I_ = nullptr;
+    std::vector<int> ids_;             ///< Candidates, tableau dense
+    std::vector<int> slot_;            ///< Indice de q dans ids_ (-1 : absente)
+    std::vector<std::uint8_t> mask_;   ///< Bit k : candidate pour la trajectoire k
+    std::vector<int> by_time_;         ///< Requêtes par temps décroissant
+    std::vector<int> cursor_;          ///< Premier indice de by_time_ non examiné, par trajectoire
+};
+
+#endif // CANDIDATE_POOL_HPP
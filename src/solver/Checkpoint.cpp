@@ -0,0 +1,255 @@
+#include "solver/Checkpoint.hpp"
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <unistd.h>
+
+/**
+ * @file Checkpoint.cpp
+ * @brief Format binaire des checkpoints, écriture atomique et thread d'écriture
+ */
+
+namespace {
+
+constexpr char kMagic[8] = {'T', 'A', 'P', 'C', 'K', 'P', 'T', '1'};
+
+std::uint64_t fnv1a(const void* data, std::size_t len, std::uint64_t h = 0xcbf29ce484222325ull) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (std::size_t k = 0; k < len; ++k) {
+        h ^= p[k];
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+/// Sérialisation dans un tampon mémoire (ordre des octets de la machine).
+class Writer {
+public:
+    template <typename T>
+    void put(const T& v) { buf.append(reinterpret_cast<const char*>(&v), sizeof(T)); }
+
+    template <typename T>
+    void put_array(const std::vector<T>& v) {
+        put<std::uint64_t>(v.size());
+        buf.append(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+    }
+
+    std::string buf;
+};
+
+/// Lecture bornée : toute lecture au-delà de la fin lève une exception.
+class Reader {
+public:
+    Reader(const std::string& buf, std::size_t end) : buf_(buf), end_(end) {}
+
+    template <typename T>
+    T get() {
+        T v;
+        take(&v, sizeof(T));
+        return v;
+    }
+
+    template <typename T>
+    void get_array(std::vector<T>& v) {
+        std::uint64_t len = get<std::uint64_t>();
+        if (len > (end_ - pos_) / sizeof(T)) throw std::runtime_error("checkpoint truncated");
+        v.resize(len);
+        take(v.data(), len * sizeof(T));
+    }
+
+private:
+    void take(void* dst, std::size_t len) {
+        if (len > end_ - pos_) throw std::runtime_error("checkpoint truncated");
+        std::memcpy(dst, buf_.data() + pos_, len);
+        pos_ += len;
+    }
+
+    const std::string& buf_;
+    std::size_t end_;
+    std::size_t pos_ = 0;
+};
+
+} // namespace
+
+std::uint64_t instance_fingerprint(const TapInstance& I) {
+    std::uint64_t h = fnv1a(&I.size, sizeof(I.size));
+    h = fnv1a(&I.epsilon_t, sizeof(double), h);
+    h = fnv1a(&I.epsilon_d, sizeof(double), h);
+    h = fnv1a(I.interest.data(), I.interest.size() * sizeof(double), h);
+    h = fnv1a(I.time.data(), I.time.size() * sizeof(double), h);
+    // Une distance par ligne (colonne décalée) : O(n), la matrice complète serait trop chère
+    for (int q = 0; q < I.size; ++q) {
+        double d = I.distance(q, (int)((q * 7919L + 1) % I.size));
+        h = fnv1a(&d, sizeof(d), h);
+    }
+    return h;
+}
+
+void save_checkpoint(const std::string& path, const Checkpoint& cp) {
+    Writer w;
+    w.buf.append(kMagic, sizeof(kMagic));
+    w.put<std::uint64_t>(cp.instance_hash);
+    w.put<std::uint8_t>(cp.finished ? 1 : 0);
+    w.put<double>(cp.elapsed_ms);
+    w.put_array(std::vector<char>(cp.solver.begin(), cp.solver.end()));
+    w.put_array(cp.rng);
+    w.put_array(cp.counters);
+    w.put<std::uint64_t>(cp.routes.size());
+    for (const auto& r : cp.routes) {
+        w.put_array(std::vector<std::int32_t>(r.begin(), r.end()));
+    }
+    w.put<std::uint64_t>(fnv1a(w.buf.data(), w.buf.size()));
+
+    const std::string tmp = path + ".tmp";
+    int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) throw std::runtime_error("cannot create checkpoint " + tmp);
+    const char* p = w.buf.data();
+    std::size_t left = w.buf.size();
+    while (left > 0) {
+        ssize_t k = ::write(fd, p, left);
+        if (k < 0) {
+            ::close(fd);
+            throw std::runtime_error("cannot write checkpoint " + tmp);
+        }
+        p += k;
+        left -= (std::size_t)k;
+    }
+    bool synced = ::fsync(fd) == 0;
+    ::close(fd);
+    if (!synced || std::rename(tmp.c_str(), path.c_str()) != 0) {
+        throw std::runtime_error("cannot commit checkpoint " + path);
+    }
+}
+
+bool load_checkpoint(const std::string& path, Checkpoint& cp) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::string buf((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    const std::size_t sum_size = sizeof(std::uint64_t);
+    if (buf.size() < sizeof(kMagic) + sum_size
+        || std::memcmp(buf.data(), kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error("not a checkpoint file: " + path);
+    }
+    const std::size_t body = buf.size() - sum_size;
+    std::uint64_t sum;
+    std::memcpy(&sum, buf.data() + body, sum_size);
+    if (sum != fnv1a(buf.data(), body)) {
+        throw std::runtime_error("checkpoint checksum mismatch: " + path);
+    }
+
+    Reader r(buf, body);
+    r.get<std::array<char, sizeof(kMagic)>>();
+    cp.instance_hash = r.get<std::uint64_t>();
+    cp.finished = r.get<std::uint8_t>() != 0;
+    cp.elapsed_ms = r.get<double>();
+    std::vector<char> name;
+    r.get_array(name);
+    cp.solver.assign(name.begin(), name.end());
+    r.get_array(cp.rng);
+    r.get_array(cp.counters);
+    std::uint64_t count = r.get<std::uint64_t>();
+    if (count > body) throw std::runtime_error("checkpoint truncated");
+    cp.routes.assign(count, {});
+    std::vector<std::int32_t> route;
+    for (auto& dst : cp.routes) {
+        r.get_array(route);
+        dst.assign(route.begin(), route.end());
+    }
+    return true;
+}
+
+Checkpointer::Checkpointer(std::string path, double interval_ms, const TapInstance& instance,
+                           std::string solver, bool resume)
+    : path_(std::move(path)),
+      interval_(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double, std::milli>(interval_ms))),
+      next_due_(std::chrono::steady_clock::now() + interval_),
+      instance_hash_(instance_fingerprint(instance)),
+      solver_(std::move(solver)) {
+    if (resume) {
+        try {
+            if (load_checkpoint(path_, resume_)) {
+                if (resume_.instance_hash != instance_hash_ || resume_.solver != solver_) {
+                    std::cerr << "Avertissement : checkpoint '" << path_ << "' écrit pour une autre "
+                                 "instance ou un autre solveur, recherche reprise de zéro\n";
+                } else {
+                    has_resume_ = true;
+                }
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "Avertissement : checkpoint illisible (" << e.what()
+                      << "), recherche reprise de zéro\n";
+        }
+    }
+    writer_ = std::thread(&Checkpointer::writer_loop, this);
+}
+
+void Checkpointer::reject_resume(const std::string& reason) {
+    if (!has_resume_) return;
+    std::cerr << "Avertissement : checkpoint '" << path_ << "' " << reason
+              << ", recherche reprise de zéro\n";
+    has_resume_ = false;
+}
+
+Checkpointer::~Checkpointer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    writer_.join();
+}
+
+void Checkpointer::submit(Checkpoint cp) {
+    cp.solver = solver_;
+    cp.instance_hash = instance_hash_;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_ = std::move(cp);
+        has_pending_ = true;
+    }
+    cv_.notify_all();
+    next_due_ = std::chrono::steady_clock::now() + interval_;
+}
+
+void Checkpointer::finish(Checkpoint cp) {
+    cp.finished = true;
+    submit(std::move(cp));
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] { return !has_pending_ && !writing_; });
+}
+
+std::uint64_t Checkpointer::writes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return writes_;
+}
+
+void Checkpointer::writer_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        cv_.wait(lock, [&] { return has_pending_ || stop_; });
+        if (!has_pending_) return;
+        Checkpoint cp = std::move(pending_);
+        has_pending_ = false;
+        writing_ = true;
+        lock.unlock();
+        bool ok = true;
+        try {
+            save_checkpoint(path_, cp);
+        } catch (const std::exception& e) {
+            ok = false;
+            std::cerr << "Erreur : " << e.what() << "\n";
+        }
+        lock.lock();
+        writing_ = false;
+        if (ok) ++writes_;
+        cv_.notify_all();
+    }
+}
@@ -0,0 +1,146 @@
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+
+#include "loaders/TapInstance.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief État sauvegardé d'une recherche longue.
+ *
+ * Le contenu de rng, counters et routes est propre à chaque solveur
+ * (voir tabu_search et memetic_solve) ; routes[0] est toujours la
+ * meilleure solution connue.
+ */
+struct Checkpoint {
+    std::string solver;                      ///< Nom du solveur (solver_kind_name)
+    std::uint64_t instance_hash = 0;         ///< Empreinte de l'instance (instance_fingerprint)
+    bool finished = false;                   ///< Recherche arrivée à sa limite (état complet, prolongeable)
+    double elapsed_ms = 0.0;                 ///< Temps de recherche cumulé sur toutes les exécutions
+    std::vector<std::uint64_t> rng;          ///< États des générateurs
+    std::vector<std::int64_t> counters;      ///< Compteurs de la recherche
+    std::vector<std::vector<int>> routes;    ///< Trajectoires (routes[0] = incumbent)
+};
+
+/**
+ * @brief Empreinte d'une instance : taille, budgets, intérêts, temps et distances.
+ *
+ * Sert à refuser la reprise d'un checkpoint écrit pour une autre instance
+ * (autre fichier, autres epsilons ou autre renumérotation).
+ */
+std::uint64_t instance_fingerprint(const TapInstance& instance);
+
+/**
+ * @brief Écrit un checkpoint de façon atomique.
+ *
+ * Format binaire : en-tête "TAPCKPT1", champs de taille fixe, tableaux
+ * préfixés par leur longueur, puis une somme de contrôle FNV-1a de tout
+ * ce qui précède. Le fichier est écrit sous path + ".tmp", synchronisé sur
+ * disque puis renommé : un arrêt brutal laisse l'ancien checkpoint intact.
+ *
+ * @throws std::runtime_error si l'écriture échoue
+ */
+void save_checkpoint(const std::string& path, const Checkpoint& cp);
+
+/**
+ * @brief Relit un checkpoint.
+ *
+ * @param path Fichier écrit par save_checkpoint
+ * @param cp   Reçoit l'état lu
+ * @return false si le fichier n'existe pas
+ * @throws std::runtime_error si le fichier est tronqué ou corrompu
+ */
+bool load_checkpoint(const std::string& path, Checkpoint& cp);
+
+/**
+ * @brief Sauvegardes périodiques d'une recherche, écrites par un thread dédié.
+ *
+ * Le thread de recherche appelle due() à sa cadence de contrôle du temps
+ * et, quand l'intervalle est écoulé, submit() avec une copie de son état :
+ * le coût sur la boucle chaude se limite à cette copie, la sérialisation
+ * et les appels système étant faits par le thread d'écriture. Si une
+ * écriture est encore en cours, seul le dernier état soumis est conservé.
+ */
+class Checkpointer {
+public:
+    /**
+     * @param path        Fichier de checkpoint
+     * @param interval_ms Intervalle entre deux sauvegardes (ms)
+     * @param instance    Instance résolue (empreinte)
+     * @param solver      Nom du solveur
+     * @param resume      Recharger path s'il existe et correspond à l'instance et au solveur
+     */
+    Checkpointer(std::string path, double interval_ms, const TapInstance& instance,
+                 std::string solver, bool resume);
+
+    /// Écrit le dernier état soumis puis arrête le thread d'écriture.
+    ~Checkpointer();
+
+    Checkpointer(const Checkpointer&) = delete;
+    Checkpointer& operator=(const Checkpointer&) = delete;
+
+    /// État à reprendre (nul si pas de reprise ou checkpoint incompatible).
+    const Checkpoint* resumed() const { return has_resume_ ? &resume_ : nullptr; }
+
+    /**
+     * @brief Refuse l'état à reprendre : la recherche repart de zéro.
+     *
+     * Appelé par le solveur quand le checkpoint ne correspond pas à ses
+     * paramètres (taille de population...) ; affiche le même avertissement
+     * qu'un checkpoint écrit pour une autre instance.
+     *
+     * @param reason Motif affiché
+     */
+    void reject_resume(const std::string& reason);
+
+    /**
+     * @brief Signale que la recherche reprise était déjà terminée.
+     *
+     * Appelé par le solveur quand un checkpoint finished n'a plus de temps
+     * ni d'itérations à recevoir : routes[0] est renvoyé tel quel.
+     */
+    void mark_already_finished() { already_finished_ = true; }
+
+    /// Vrai si la reprise n'a rien laissé à chercher (voir mark_already_finished).
+    bool already_finished() const { return already_finished_; }
+
+    /// Vrai si l'intervalle depuis la dernière soumission est écoulé.
+    bool due() const { return std::chrono::steady_clock::now() >= next_due_; }
+
+    /// Confie un état au thread d'écriture (solver et instance_hash sont remplis ici).
+    void submit(Checkpoint cp);
+
+    /// Soumet l'état final (finished = true, complet pour être prolongé) et attend qu'il soit sur disque.
+    void finish(Checkpoint cp);
+
+    /// Nombre de checkpoints écrits.
+    std::uint64_t writes() const;
+
+private:
+    void writer_loop();
+
+    std::string path_;
+    std::chrono::steady_clock::duration interval_;
+    std::chrono::steady_clock::time_point next_due_;
+    std::uint64_t instance_hash_;
+    std::string solver_;
+    Checkpoint resume_;
+    bool has_resume_ = false;
+    bool already_finished_ = false;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    Checkpoint pending_;
+    bool has_pending_ = false;
+    bool writing_ = false;
+    bool stop_ = false;
+    std::uint64_t writes_ = 0;
+    std::thread writer_;
+};
+
+#endif // CHECKPOINT_HPP
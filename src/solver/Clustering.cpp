@@ -0,0 +1,149 @@
+#include "solver/Clustering.hpp"
+#include "loaders/DistanceProvider.hpp"
+#include "solver/Parallel.hpp"
+#include <algorithm>
+#include <limits>
+#include <random>
+
+/**
+ * @file Clustering.cpp
+ * @brief k-medoids parallèle sur la matrice de distances et ordre de visite des groupes
+ */
+
+namespace {
+
+// Bornes de l'échantillonnage de la mise à jour des medoids
+constexpr int kMedoidCandidates = 32;
+constexpr int kMedoidSample = 256;
+
+/// Distance symétrisée : la matrice peut être asymétrique.
+template <typename Dist>
+inline double sym_dist(const Dist& D, int a, int b) {
+    return 0.5 * (D(a, b) + D(b, a));
+}
+
+/// Taille des blocs de requêtes traités par tâche lors de l'affectation.
+constexpr int kAssignBlock = 1024;
+
+template <typename Dist>
+Clustering k_medoids_impl(const Dist& D, int k, int max_iters, std::uint64_t seed, int threads) {
+    const int n = D.size();
+    Clustering C;
+    if (n == 0) return C;
+    k = std::max(1, std::min(k, n));
+
+    // 1) Initialisation farthest-first
+    std::mt19937_64 rng(seed);
+    C.medoids.push_back((int)(rng() % (std::uint64_t)n));
+    std::vector<double> nearest(n, std::numeric_limits<double>::infinity());
+    while ((int)C.medoids.size() < k) {
+        int last = C.medoids.back();
+        int far = -1;
+        double farD = -1.0;
+        for (int i = 0; i < n; ++i) {
+            nearest[i] = std::min(nearest[i], sym_dist(D, i, last));
+            if (nearest[i] > farD) {
+                farD = nearest[i];
+                far = i;
+            }
+        }
+        if (farD <= 0.0) {
+            // Tous les points restants coïncident avec un medoid : compléter par des requêtes libres
+            std::vector<char> is_medoid(n, 0);
+            for (int m : C.medoids) is_medoid[m] = 1;
+            for (int i = 0; i < n && (int)C.medoids.size() < k; ++i) {
+                if (!is_medoid[i]) C.medoids.push_back(i);
+            }
+            break;
+        }
+        C.medoids.push_back(far);
+    }
+
+    C.assignment.assign(n, 0);
+    const int blocks = (n + kAssignBlock - 1) / kAssignBlock;
+    for (int iter = 0; iter < std::max(1, max_iters); ++iter) {
+        // 2) Affectation au medoid le plus proche (par blocs de requêtes)
+        std::vector<char> changed(blocks, 0);
+        parallel_for(blocks, threads, [&](int b) {
+            int lo = b * kAssignBlock, hi = std::min(n, lo + kAssignBlock);
+            for (int i = lo; i < hi; ++i) {
+                int best = 0;
+                double bestD = std::numeric_limits<double>::infinity();
+                for (int c = 0; c < k; ++c) {
+                    double d = sym_dist(D, i, C.medoids[c]);
+                    if (d < bestD) {
+                        bestD = d;
+                        best = c;
+                    }
+                }
+                if (C.assignment[i] != best || iter == 0) changed[b] = 1;
+                C.assignment[i] = best;
+            }
+        });
+        // Un medoid appartient toujours à son propre groupe (pas de groupe vide)
+        for (int c = 0; c < k; ++c) C.assignment[C.medoids[c]] = c;
+
+        C.members.assign(k, {});
+        for (int i = 0; i < n; ++i) C.members[C.assignment[i]].push_back(i);
+
+        if (iter > 0 && std::find(changed.begin(), changed.end(), 1) == changed.end()) break;
+
+        // 3) Mise à jour : medoid = candidat de coût total minimal (échantillonné)
+        parallel_for(k, threads, [&](int c) {
+            const std::vector<int>& mem = C.members[c];
+            const int sz = (int)mem.size();
+            const int cstride = std::max(1, sz / kMedoidCandidates);
+            const int sstride = std::max(1, sz / kMedoidSample);
+            auto cost = [&](int cand) {
+                double total = 0.0;
+                for (int j = 0; j < sz; j += sstride) total += sym_dist(D, cand, mem[j]);
+                return total;
+            };
+            int best = C.medoids[c];
+            double bestCost = cost(best);
+            for (int j = 0; j < sz; j += cstride) {
+                double v = cost(mem[j]);
+                if (v < bestCost) {
+                    bestCost = v;
+                    best = mem[j];
+                }
+            }
+            C.medoids[c] = best;
+        });
+    }
+    return C;
+}
+
+} // namespace
+
+Clustering k_medoids(const TapInstance& I, int k, int max_iters, std::uint64_t seed, int threads) {
+    return visit_distances(I, [&](const auto& D) {
+        return k_medoids_impl(D, k, max_iters, seed, threads);
+    });
+}
+
+std::vector<int> order_clusters(const TapInstance& I, const Clustering& C, int first) {
+    const int k = (int)C.medoids.size();
+    std::vector<int> order;
+    if (k == 0) return order;
+    std::vector<char> visited(k, 0);
+    int cur = std::clamp(first, 0, k - 1);
+    order.push_back(cur);
+    visited[cur] = 1;
+    while ((int)order.size() < k) {
+        int next = -1;
+        double bestD = std::numeric_limits<double>::infinity();
+        for (int c = 0; c < k; ++c) {
+            if (visited[c]) continue;
+            double d = I.distance(C.medoids[cur], C.medoids[c]);
+            if (d < bestD) {
+                bestD = d;
+                next = c;
+            }
+        }
+        order.push_back(next);
+        visited[next] = 1;
+        cur = next;
+    }
+    return order;
+}
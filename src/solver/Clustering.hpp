@@ -0,0 +1,46 @@
+#ifndef CLUSTERING_HPP
+#define CLUSTERING_HPP
+
+#include "loaders/TapInstance.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Partition des requêtes d'une instance en groupes proches.
+ */
+struct Clustering {
+    std::vector<int> medoids;               ///< Requête représentative de chaque groupe
+    std::vector<int> assignment;            ///< Groupe de chaque requête (taille n)
+    std::vector<std::vector<int>> members;  ///< Requêtes de chaque groupe, par indice croissant
+};
+
+/**
+ * @brief Partitionne les requêtes par k-medoids sur la matrice de distances.
+ *
+ * Initialisation "farthest-first" à partir d'une requête tirée selon la
+ * graine, puis alternance affectation / mise à jour des medoids. Les deux
+ * étapes sont parallélisées (par blocs de requêtes, puis par groupe). La
+ * mise à jour évalue un échantillon borné de candidats et de membres pour
+ * rester en O(n) par itération sur les grandes instances.
+ *
+ * @param I         Instance TAP
+ * @param k         Nombre de groupes (borné à n)
+ * @param max_iters Nombre maximal d'itérations affectation / mise à jour
+ * @param seed      Graine du premier medoid
+ * @param threads   Nombre de threads (0 = nombre de cœurs)
+ * @return La partition obtenue (aucun groupe vide)
+ */
+Clustering k_medoids(const TapInstance& I, int k, int max_iters = 10,
+                     std::uint64_t seed = 0, int threads = 0);
+
+/**
+ * @brief Ordonne des groupes par plus proche voisin entre medoids.
+ *
+ * @param I     Instance TAP
+ * @param C     Partition
+ * @param first Groupe de départ
+ * @return Indices des groupes dans l'ordre de visite
+ */
+std::vector<int> order_clusters(const TapInstance& I, const Clustering& C, int first = 0);
+
+#endif // CLUSTERING_HPP
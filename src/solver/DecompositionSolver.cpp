@@ -0,0 +1,184 @@
+#include "solver/DecompositionSolver.hpp"
+#include "solver/Clustering.hpp"
+#include "solver/GreedySolver.hpp"
+#include "solver/Parallel.hpp"
+#include "solver/RouteOps.hpp"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+
+/**
+ * @file DecompositionSolver.cpp
+ * @brief Solveur "cluster-first" pour les instances de plusieurs dizaines de milliers de requêtes
+ *
+ * greedy_solve est en O(n^2 * m) : au-delà de quelques milliers de requêtes,
+ * on résout des sous-instances de taille bornée puis on recolle les routes.
+ */
+
+namespace {
+
+// Nombre maximal de requêtes essayées lors du remplissage final
+constexpr size_t kMaxFillCandidates = 4096;
+
+/// Distance d'une sous-route parcourue dans un sens ou dans l'autre.
+template <typename Dist>
+double route_cost(const Dist& D, const std::vector<int>& r, bool reversed) {
+    double total = 0.0;
+    for (size_t i = 0; i + 1 < r.size(); ++i) {
+        total += reversed ? D(r[i + 1], r[i]) : D(r[i], r[i + 1]);
+    }
+    return total;
+}
+
+/**
+ * @brief Extrait la sous-instance d'un groupe avec ses budgets propres.
+ *
+ * La sous-instance est toujours dense (m x m, m de l'ordre de
+ * cluster_size) : greedy_solve s'y applique quelle que soit la
+ * représentation de l'instance complète.
+ */
+template <typename Dist>
+TapInstance make_sub_instance(const TapInstance& I, const Dist& D,
+                              const std::vector<int>& members,
+                              double eps_t, double eps_d, int cluster) {
+    const int m = (int)members.size();
+    std::vector<double> interest(m), time(m);
+    std::vector<std::vector<double>> dist(m, std::vector<double>(m));
+    for (int i = 0; i < m; ++i) {
+        interest[i] = I.interest[members[i]];
+        time[i]     = I.time[members[i]];
+        for (int j = 0; j < m; ++j) dist[i][j] = D(members[i], members[j]);
+    }
+    return TapInstance(I.filename + "#" + std::to_string(cluster),
+                       std::move(interest), std::move(time), std::move(dist), eps_t, eps_d);
+}
+
+/**
+ * @brief Étapes 1 à 5 de decomposition_solve, instanciées par vue de distances.
+ */
+template <typename Dist>
+std::vector<int> decompose(const TapInstance& I, const Dist& D, int k,
+                           const DecompositionConfig& cfg, SolverStats& st,
+                           IncumbentTrace* trace) {
+    const int n = I.size;
+
+    // 1) Partition des requêtes
+    Clustering C;
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::DecompCluster);
+        C = k_medoids(I, k, cfg.kmedoid_iters, cfg.seed, cfg.threads);
+    }
+    k = (int)C.medoids.size();
+
+    // 2) Potentiel de chaque groupe, ordre de visite et réserve pour les raccords
+    std::vector<double> potential(k, 0.0);
+    double total_potential = 0.0;
+    for (int c = 0; c < k; ++c) {
+        for (int q : C.members[c]) potential[c] += I.interest[q] / I.time[q];
+        total_potential += potential[c];
+    }
+    int first = (int)(std::max_element(potential.begin(), potential.end()) - potential.begin());
+    std::vector<int> order = order_clusters(I, C, first);
+    double reserve = 0.0;
+    for (size_t i = 0; i + 1 < order.size(); ++i) {
+        reserve += D(C.medoids[order[i]], C.medoids[order[i + 1]]);
+    }
+    reserve = std::min(reserve, cfg.stitch_reserve * I.epsilon_d);
+    const double eps_d_pool = I.epsilon_d - reserve;
+
+    // 3) Résolution concurrente des sous-instances
+    std::vector<std::vector<int>> routes(k);
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::DecompSolve);
+        std::mutex stats_mutex;
+        // Mémoire de travail de chaque thread : son espace de travail et sa
+        // plus grande sous-instance (une seule à la fois par thread)
+        std::map<const SolverWorkspace*, std::size_t> thread_bytes;
+        parallel_for(k, cfg.threads, [&](int c) {
+            double share = total_potential > 0 ? potential[c] / total_potential : 1.0 / k;
+            TapInstance sub = make_sub_instance(I, D, C.members[c], I.epsilon_t * share,
+                                                eps_d_pool * share, c);
+            SolverStats sub_stats;
+            std::vector<int> r = greedy_solve(sub, &sub_stats);
+            for (int& q : r) q = C.members[c][q];
+            routes[c] = std::move(r);
+            const std::size_t bytes = sub_stats.workspace_bytes + sub.memory_usage().total();
+            sub_stats.workspace_bytes = 0;
+            std::lock_guard<std::mutex> lock(stats_mutex);
+            std::size_t& used = thread_bytes[&SolverWorkspace::local()];
+            used = std::max(used, bytes);
+            st.merge(sub_stats);
+        });
+        for (const auto& t : thread_bytes) st.workspace_bytes += t.second;
+    }
+
+    // 4) Raccord des sous-routes, chacune orientée au plus court
+    std::vector<int> path;
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::DecompStitch);
+        for (int c : order) {
+            std::vector<int>& r = routes[c];
+            if (r.empty()) continue;
+            if (!path.empty()) {
+                int last = path.back();
+                double fwd = D(last, r.front()) + route_cost(D, r, false);
+                double rev = D(last, r.back())  + route_cost(D, r, true);
+                if (rev < fwd) std::reverse(r.begin(), r.end());
+            }
+            path.insert(path.end(), r.begin(), r.end());
+        }
+    }
+
+    // 5) Réparation globale puis amélioration
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::DecompRepair);
+        std::vector<char> used(n, 0);
+        for (int q : path) used[q] = 1;
+        double T = I.solution_time(path);
+        double len = I.solution_distance(path);
+        repair_route(I, D, path, used, T, len);
+        [[maybe_unused]] int moves = route_two_opt(D, path, len, 2);
+        TAP_STAT(st.two_opt_passes += 2);
+        TAP_STAT(st.two_opt_moves += moves);
+        if (trace) trace->record(I.solution_interest(path), "Decomposition/repair");
+
+        // Remplissage : requêtes libres par ratio intérêt / temps décroissant
+        std::vector<int> cand;
+        for (int q = 0; q < n; ++q) {
+            if (!used[q] && T + I.time[q] <= I.epsilon_t) cand.push_back(q);
+        }
+        std::sort(cand.begin(), cand.end(), [&](int a, int b) {
+            return I.interest[a] * I.time[b] > I.interest[b] * I.time[a];
+        });
+        if (cand.size() > kMaxFillCandidates) cand.resize(kMaxFillCandidates);
+        fill_route(I, D, path, used, T, len, cand);
+    }
+    if (trace) trace->record(I.solution_interest(path), "Decomposition");
+    return path;
+}
+
+} // namespace
+
+std::vector<int> decomposition_solve(const TapInstance& I, const DecompositionConfig& cfg,
+                                     SolverStats* stats, IncumbentTrace* trace) {
+    const int n = I.size;
+    int k = cfg.clusters > 0
+          ? cfg.clusters
+          : (int)std::lround((double)n / (double)std::max(1, cfg.cluster_size));
+    k = std::min(k, n);
+    if (k < 2) {
+        // Petite instance : greedy_solve lit la matrice dense
+        if (I.backend == DistanceBackend::Dense) return greedy_solve(I, stats, trace);
+        TapInstance dense = I.materialized();
+        std::vector<int> route = greedy_solve(dense, stats, trace);
+        if (stats) stats->workspace_bytes += dense.memory_usage().total();
+        return route;
+    }
+
+    SolverStats local;
+    SolverStats& st = stats ? *stats : local;
+    return visit_distances(I, [&](const auto& D) {
+        return decompose(I, D, k, cfg, st, trace);
+    });
+}
@@ -0,0 +1,52 @@
+#ifndef DECOMPOSITION_SOLVER_HPP
+#define DECOMPOSITION_SOLVER_HPP
+
+#include "loaders/TapInstance.hpp"
+#include "solver/IncumbentTrace.hpp"
+#include "solver/SolverStats.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Paramètres du solveur par décomposition.
+ */
+struct DecompositionConfig {
+    int clusters = 0;           ///< Nombre de groupes (0 = n / cluster_size arrondi)
+    int cluster_size = 400;     ///< Taille visée d'un groupe si clusters == 0
+    int kmedoid_iters = 10;     ///< Itérations maximales du k-medoids
+    int threads = 0;            ///< Threads de résolution (0 = nombre de cœurs)
+    std::uint64_t seed = 0;     ///< Graine du k-medoids
+    double stitch_reserve = 0.3;///< Part maximale de epsilon_d réservée aux raccords
+};
+
+/**
+ * @brief Résout une très grande instance TAP par décomposition en groupes.
+ *
+ * 1) Partition des requêtes par k-medoids (parallèle) ;
+ * 2) Répartition des epsilons entre groupes au prorata de leur potentiel
+ *    (somme des ratios intérêt / temps), après réserve des arcs de raccord ;
+ * 3) Résolution concurrente de chaque sous-instance par greedy_solve ;
+ * 4) Raccord des sous-routes dans l'ordre plus proche voisin des medoids,
+ *    chaque sous-route étant orientée pour minimiser l'arc de jonction ;
+ * 5) Réparation (retrait des requêtes les moins rentables jusqu'à la
+ *    faisabilité), 2-opt, puis remplissage avec le budget restant.
+ *
+ * En dessous de deux groupes, délègue directement à greedy_solve.
+ *
+ * Seul solveur qui accepte les trois représentations des distances
+ * (Dense, Compact, Oracle) : les sous-instances sont extraites en
+ * matrices denses de taille cluster_size, le reste du calcul passe par
+ * la vue de distances de l'instance.
+ *
+ * @param instance Instance TAP à résoudre
+ * @param cfg      Paramètres de la décomposition
+ * @param stats    Si non nul, reçoit les durées par phase et les compteurs cumulés
+ * @param trace    Si non nul, reçoit les incumbents horodatés
+ * @return Séquence d'indices de requêtes faisable
+ */
+std::vector<int> decomposition_solve(const TapInstance& instance,
+                                     const DecompositionConfig& cfg = DecompositionConfig(),
+                                     SolverStats* stats = nullptr,
+                                     IncumbentTrace* trace = nullptr);
+
+#endif // DECOMPOSITION_SOLVER_HPP
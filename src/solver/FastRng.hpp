@@ -0,0 +1,39 @@
+#ifndef FAST_RNG_HPP
+#define FAST_RNG_HPP
+
+#include <cstdint>
+
+/**
+ * @brief Générateur xorshift64* : tirages bon marché dans les boucles des métaheuristiques.
+ *
+ * Qualité statistique suffisante pour choisir des coups ou des parents,
+ * état de 8 octets (un générateur par enfant ou par thread ne coûte rien).
+ */
+class FastRng {
+public:
+    explicit FastRng(std::uint64_t seed) : s_(seed * 0x9E3779B97F4A7C15ull + 0x2545F4914F6CDD1Dull) {
+        if (s_ == 0) s_ = 1;
+    }
+
+    std::uint64_t next() {
+        s_ ^= s_ >> 12;
+        s_ ^= s_ << 25;
+        s_ ^= s_ >> 27;
+        return s_ * 0x2545F4914F6CDD1Dull;
+    }
+
+    /// Entier uniforme dans [0, n).
+    std::uint32_t below(std::uint32_t n) { return (std::uint32_t)(((next() >> 32) * n) >> 32); }
+
+    /// Réel uniforme dans [0, 1).
+    double uniform() { return (double)(next() >> 11) * (1.0 / 9007199254740992.0); }
+
+    /// État interne (checkpoint) ; set_state(state()) reprend la même suite de tirages.
+    std::uint64_t state() const { return s_; }
+    void set_state(std::uint64_t s) { s_ = s ? s : 1; }
+
+private:
+    std::uint64_t s_;
+};
+
+#endif // FAST_RNG_HPP
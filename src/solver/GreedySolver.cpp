@@ -1,185 +1,416 @@
 #include "solver/GreedySolver.hpp"
+#include "solver/RouteOps.hpp"
+#include "solver/SolverWorkspace.hpp"
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <limits>
 #include <numeric>
 #include <random>
+#include <tuple>
+#include <utility>
 
-// =============================================================================
-//  Helper functions for feasibility checks and distance/insertion computations
-// =============================================================================
+// -----------------------------------------------------------------------------
+//  0. Politiques de score et boucle d'insertion commune
+//     FastGreedy et EnhancedGreedy ne diffèrent, pendant l'insertion, que par
+//     le score d'une insertion et la règle de départ. Chaque variante est une
+//     politique dont les règles sont fixées à la compilation ; la boucle
+//     d'insertion est un modèle instancié pour le tuple de politiques et fait
+//     avancer toutes les trajectoires au cours d'un même balayage des
+//     requêtes. Ajouter une variante : écrire une politique et l'ajouter au
+//     tuple de greedy_solve, sans aiguillage dans la boucle chaude.
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Départage de deux insertions de même score.
+ */
+enum class TieBreak {
+    First,           ///< Garde la première rencontrée (requête puis position croissantes)
+    ShortestDetour   ///< Préfère le plus petit détour
+};
 
 /**
- * @brief Vérifie si les contraintes temps et distance sont respectées.
+ * @brief Politique de FastGreedy : intérêt / (temps + détour).
  *
- * Permet de s'assurer à chaque étape que l'on ne dépasse pas
- * les budgets epsilon définis pour l'instance TAP.
+ * La requête de départ doit tenir seule dans epsilon_t.
+ */
+struct FastScore {
+    static constexpr bool seed_within_budget = true;  ///< Départ filtré sur epsilon_t
+    static constexpr TieBreak tie = TieBreak::First;  ///< Départage des ex aequo
+
+    explicit FastScore(const TapInstance&) {}
+
+    double operator()(double interest, double dt, double dd) const {
+        double cost = dt + dd + 1e-9; // Petite constante pour éviter div/0
+        return interest / cost;
+    }
+
+    /// Score strictement décroissant en détour à partir de dd (coût positif).
+    bool decreasing_from(double dt, double dd) const { return dt + dd + 1e-9 > 0; }
+};
+
+/**
+ * @brief Politique d'EnhancedGreedy : intérêt / (temps / epsilon_t + détour / epsilon_d).
  *
- * @param t  Temps cumulé actuel
- * @param d  Distance cumulée actuelle
- * @param I  Instance TAP (contient epsilon_t et epsilon_d)
- * @return true si t et d sont inférieurs ou égaux aux epsilons
+ * Normalise les deux coûts par leur budget ; le départ n'est pas filtré.
+ */
+struct NormalizedScore {
+    static constexpr bool seed_within_budget = false;
+    static constexpr TieBreak tie = TieBreak::First;
+
+    double wT;   ///< 1 / epsilon_t
+    double wD;   ///< 1 / epsilon_d
+
+    explicit NormalizedScore(const TapInstance& I)
+        : wT(1.0 / I.epsilon_t), wD(1.0 / I.epsilon_d) {}
+
+    double operator()(double interest, double dt, double dd) const {
+        double cost = dt * wT + dd * wD;
+        if (cost <= 0) cost = 1e-9;
+        return interest / cost;
+    }
+
+    /// Score strictement décroissant en détour à partir de dd (coût non borné).
+    bool decreasing_from(double dt, double dd) const { return dt * wT + dd * wD > 0; }
+};
+
+/// Trajectoire en construction (tampons de SolverWorkspace).
+using Path = WorkPath;
+
+/**
+ * @brief Meilleure insertion rencontrée pendant un balayage.
+ */
+struct Insertion {
+    int q = -1;             ///< Requête (-1 : aucune insertion faisable)
+    size_t pos = 0;         ///< Position d'insertion
+    double score = -1.0;    ///< Score selon la politique
+    double dt = 0.0;        ///< Temps ajouté
+    double dd = 0.0;        ///< Détour ajouté
+};
+
+/**
+ * @brief Garde (q, pos) si son score bat la meilleure insertion selon Policy.
+ *
+ * À score égal, la requête de plus petit indice l'emporte (ordre du
+ * balayage complet), quel que soit l'ordre de parcours des candidates.
+ */
+template <typename Policy>
+inline void consider(const Policy& policy, Insertion& best, int q, size_t pos,
+                     double interest, double dt, double dd) {
+    double score = policy(interest, dt, dd);
+    bool better = score > best.score;
+    if (score == best.score) {
+        if constexpr (Policy::tie == TieBreak::ShortestDetour) {
+            better = dd < best.dd || (dd == best.dd && q < best.q);
+        } else {
+            better = q < best.q;
+        }
+    }
+    if (better) best = {q, pos, score, dt, dd};
+}
+
+/**
+ * @brief Évalue toutes les positions d'insertion de q dans P selon Policy.
  */
-static inline bool feasible(double t, double d, const TapInstance& I) {
-    return t <= I.epsilon_t && d <= I.epsilon_d;
+template <typename Policy>
+inline void scan_candidate(const TapInstance& I, const Policy& policy, const Path& P,
+                           Insertion& best, int q, double interest, double dt,
+                           [[maybe_unused]] SolverStats& st) {
+    if (P.used.test(q)) return;
+    TAP_STAT(++st.candidates_scanned);
+    const size_t m = P.nodes.size();
+    // Temps insuffisant : aucune position n'est faisable
+    if (P.time + dt > I.epsilon_t) {
+        TAP_STAT(st.evaluations_avoided += m + 1);
+        return;
+    }
+    for (size_t pos = 0; pos <= m; ++pos) {
+        TAP_STAT(++st.insertion_evaluations);
+        double dd = delta_dist_ins(I, P.nodes, q, pos);
+        // Vérifier la faisabilité après insertion
+        if (!feasible(P.time + dt, P.dist + dd, I)) {
+            TAP_STAT(++st.feasibility_rejections);
+            continue;
+        }
+        consider(policy, best, q, pos, interest, dt, dd);
+    }
+}
+
+/**
+ * @brief Met à jour le plus petit détour de q dans P après la dernière insertion.
+ */
+static void refresh_detour(const TapInstance& I, const Path& P, DetourCache& C, int q,
+                           [[maybe_unused]] SolverStats& st) {
+    const int m = (int)P.nodes.size();
+    int at = C.known.test(q) ? C.pos[q] : -1;
+    if (at < 0 || at == C.split) {
+        // Première évaluation ou meilleur arc coupé : toutes les positions
+        double best = delta_dist_ins(I, P.nodes, q, 0);
+        at = 0;
+        for (int pos = 1; pos <= m; ++pos) {
+            double dd = delta_dist_ins(I, P.nodes, q, pos);
+            if (dd < best) {
+                best = dd;
+                at = pos;
+            }
+        }
+        TAP_STAT(st.insertion_evaluations += m + 1);
+        C.dd[q] = best;
+        C.pos[q] = at;
+        C.known.set(q);
+        return;
+    }
+    const int p = C.split;
+    if (at > p) ++at;
+    for (int pos = p; pos <= p + 1; ++pos) {
+        double dd = delta_dist_ins(I, P.nodes, q, pos);
+        if (dd < C.dd[q] || (dd == C.dd[q] && pos < at)) {
+            C.dd[q] = dd;
+            at = pos;
+        }
+    }
+    TAP_STAT(st.insertion_evaluations += 2);
+    C.pos[q] = at;
 }
 
 /**
- * @brief Calcule la variation de distance si l'on insère la requête q à la position pos de la trajectoire P.
+ * @brief Évalue q pour une trajectoire à partir de son détour en cache.
  *
- * Utile pour évaluer le coût additionnel (en distance) de chaque insertion potentielle
- * dans l'heuristique d'insertion gloutonne.
+ * Le plus petit détour (première position à égalité) est la position de
+ * meilleur score, celle du balayage complet, tant que le score décroît
+ * strictement avec le détour. Ce n'est plus le cas quand le coût de la
+ * politique est négatif ou borné (détour négatif, matrice non métrique) :
+ * q est alors évaluée position par position, comme par scan_candidate
+ * (le plus petit détour reste un test de faisabilité exact).
+ */
+template <typename Policy>
+inline void scan_cached(const TapInstance& I, const Policy& policy, const Path& P,
+                        DetourCache& C, Insertion& best, int q, double interest, double dt,
+                        SolverStats& st) {
+    TAP_STAT(++st.candidates_scanned);
+    refresh_detour(I, P, C, q, st);
+    const double dd = C.dd[q];
+    if (!feasible(P.time + dt, P.dist + dd, I)) {
+        TAP_STAT(++st.feasibility_rejections);
+        return;
+    }
+    if (policy.decreasing_from(dt, dd)) {
+        consider(policy, best, q, (size_t)C.pos[q], interest, dt, dd);
+        return;
+    }
+    for (size_t pos = 0; pos <= P.nodes.size(); ++pos) {
+        TAP_STAT(++st.insertion_evaluations);
+        double d = delta_dist_ins(I, P.nodes, q, pos);
+        if (!feasible(P.time + dt, P.dist + d, I)) {
+            TAP_STAT(++st.feasibility_rejections);
+            continue;
+        }
+        consider(policy, best, q, pos, interest, dt, d);
+    }
+}
+
+/**
+ * @brief Choisit la requête de départ sur le meilleur ratio intérêt/temps et l'insère.
  *
- * @param I    Instance TAP (contient matrice dist)
- * @param P    Séquence actuelle de requêtes
- * @param q    Indice de la requête candidate à insérer
- * @param pos  Position d'insertion dans P (0 = début, P.size() = fin)
- * @return Gain ou perte de distance (delta) dû à l'insertion
+ * @return false si aucune requête n'est admissible (trajectoire vide)
  */
-static inline double delta_dist_ins(
-    const TapInstance& I,
-    const std::vector<int>& P,
-    int q,
-    size_t pos
-) {
-    const size_t m = P.size();
-    if (m == 0) {
-        // Pas de déplacement préalable si la trajectoire est vide
-        return 0.0;
+template <typename Policy>
+static bool seed_path(const TapInstance& I, Path& P) {
+    const int n = I.size;
+    if (n == 0) return false;
+    int seed = Policy::seed_within_budget ? -1 : 0;
+    double best = -1.0;
+    for (int i = 0; i < n; ++i) {
+        if constexpr (Policy::seed_within_budget) {
+            if (I.time[i] > I.epsilon_t) continue;  // Filtrer les requêtes impossibles dès le départ
+        }
+        double r = I.interest[i] / I.time[i];
+        if (r > best) {
+            best = r;
+            seed = i;
+        }
     }
-    if (pos == 0) {
-        // Insertion en tête : coût = distance entre q et ancien premier
-        return I.dist[q][P[0]];
-    } else if (pos == m) {
-        // Insertion en fin   : coût = distance entre ancien dernier et q
-        return I.dist[P.back()][q];
-    } else {
-        // Insertion au milieu : coûte la somme des deux nouveaux arcs moins l'ancien arc
-        int a = P[pos - 1];
-        int b = P[pos];
-        return I.dist[a][q] + I.dist[q][b] - I.dist[a][b];
+    if (seed < 0) return false;
+    P.insert(seed, 0, I.time[seed], 0.0, I.interest[seed]);
+    return true;
+}
+
+template <typename... Policies, size_t... K>
+static void fused_insertion_impl(const TapInstance& I, const std::tuple<Policies...>& policies,
+                                 const std::array<Path*, sizeof...(Policies)>& paths,
+                                 std::array<bool, sizeof...(Policies)> active,
+                                 GreedyWorkspace& ws, SolverStats& st, std::index_sequence<K...>) {
+    constexpr size_t N = sizeof...(Policies);
+    static_assert(N <= CandidatePool::kMaxPaths, "too many greedy policies");
+    const int n = I.size;
+    CandidatePool& pool = ws.pool;
+    pool.reset(I, (int)N);
+    std::array<DetourCache, CandidatePool::kMaxPaths>& cache = ws.detour;
+    for (size_t k = 0; k < N; ++k) {
+        cache[k].clear(n);
+        if (!active[k]) {
+            pool.drop_all((int)k);
+            continue;
+        }
+        for (int q : paths[k]->nodes) pool.drop(q, (int)k);
+        [[maybe_unused]] int retired = pool.retire_over_time((int)k, paths[k]->time);
+        TAP_STAT(st.candidates_retired += retired);
+    }
+
+    for (;;) {
+        std::array<Insertion, N> best{};
+        [[maybe_unused]] const std::uint64_t evaluated = st.insertion_evaluations;
+        // Un seul balayage des candidates vivantes : intérêt, temps et ligne
+        // de q servent à toutes les trajectoires dont q est encore candidate
+        for (int q : pool.ids()) {
+            const double interest = I.interest[q];
+            const double dt = I.time[q];
+            ((pool.live(q, (int)K) ? scan_cached(I, std::get<K>(policies), *paths[K], cache[K],
+                                                 best[K], q, interest, dt, st)
+                                   : void()), ...);
+        }
+#if TAP_SOLVER_STATS
+        // Référence : toutes les positions de toutes les requêtes non insérées
+        std::uint64_t full = 0;
+        for (size_t k = 0; k < N; ++k) {
+            if (!active[k]) continue;
+            std::uint64_t m = paths[k]->nodes.size();
+            full += (n - m) * (m + 1);
+        }
+        st.evaluations_avoided += full - (st.insertion_evaluations - evaluated);
+#endif
+        bool progress = false;
+        for (size_t k = 0; k < N; ++k) {
+            if (!active[k]) continue;
+            if (best[k].q < 0) {
+                active[k] = false;   // Plus aucune insertion faisable pour cette trajectoire
+                pool.drop_all((int)k);
+                continue;
+            }
+            paths[k]->insert(best[k].q, best[k].pos, best[k].dt, best[k].dd,
+                             I.interest[best[k].q]);
+            cache[k].split = (int)best[k].pos;
+            pool.drop(best[k].q, (int)k);
+            [[maybe_unused]] int retired = pool.retire_over_time((int)k, paths[k]->time);
+            TAP_STAT(st.candidates_retired += retired);
+            progress = true;
+        }
+        if (!progress) return;
     }
 }
 
+/**
+ * @brief Insertion gloutonne fusionnée : une trajectoire par politique.
+ *
+ * À chaque tour, chaque trajectoire active reçoit sa meilleure insertion
+ * selon sa politique ; une trajectoire sans insertion faisable s'arrête.
+ * Les trajectoires étant indépendantes, le résultat est celui de boucles
+ * séparées, mais les requêtes ne sont balayées qu'une fois par tour.
+ *
+ * Seules les candidates vivantes du CandidatePool sont balayées : une
+ * requête qui ne tient plus dans le temps restant d'une trajectoire en est
+ * retirée définitivement, et le détour minimal de chaque candidate est
+ * tenu à jour par DetourCache (deux positions par tour au lieu de m + 1).
+ * Une candidate dont ce détour dépasse le budget de distance restant est
+ * écartée pour le tour sans évaluer ses positions. Elle n'est pas retirée :
+ * sur une matrice non métrique, un détour négatif peut faire baisser la
+ * distance cumulée.
+ *
+ * @param policies Politiques de score, une par trajectoire
+ * @param paths    Trajectoires amorcées (seed_path)
+ * @param active   Trajectoires à faire progresser (false : non amorcée)
+ * @param ws       Tampons (pool de candidates, caches de détours)
+ * @param st       Statistiques (compteurs cumulés sur toutes les trajectoires)
+ */
+template <typename... Policies>
+static void fused_insertion(const TapInstance& I, const std::tuple<Policies...>& policies,
+                            const std::array<Path*, sizeof...(Policies)>& paths,
+                            const std::array<bool, sizeof...(Policies)>& active,
+                            GreedyWorkspace& ws, SolverStats& st) {
+    fused_insertion_impl(I, policies, paths, active, ws, st,
+                         std::index_sequence_for<Policies...>{});
+}
+
 // -----------------------------------------------------------------------------
 //  1. FastGreedy
 //     Heuristique rapide basée sur insertion gloutonne + 2-opt + append tail
 // -----------------------------------------------------------------------------
 
 /**
- * @brief Implémente la version "FastGreedy" de l'heuristique.
+ * @brief Termine la version "FastGreedy" de l'heuristique.
  *
+ * Les deux premières étapes sont communes (seed_path, fused_insertion) :
  * 1) Sélection d'une requête de départ (seed) sur le meilleur ratio intérêt/temps
  * 2) Insertion itérative : à chaque itération, on teste toutes les requêtes non utilisées et leurs
  *    positions d'insertion pour maximiser le ratio intérêt / (temps + distance)
+ * Puis :
  * 3) Amélioration locale 2-opt sur la séquence pour réduire la distance totale
  * 4) Ajout en fin (tail append) de toutes les requêtes restantes si les contraintes le permettent
  *
- * @param I  Instance TAP à résoudre
- * @return Séquence d'indices représentant la solution gloutonne
+ * @param I   Instance TAP à résoudre
+ * @param P   Trajectoire issue de l'insertion (non vide), complétée en place
+ * @param st  Statistiques de résolution à compléter
  */
-static std::vector<int> FastGreedy(const TapInstance& I) {
+static void FastGreedy(const TapInstance& I, Path& P, SolverStats& st) {
     const int n = I.size;
-    std::vector<bool> used(n, false);    // Marque les requêtes déjà sélectionnées
-    std::vector<int> path;               // Séquence courante
-    double T = 0.0, D = 0.0;             // Temps et distance cumulés
-
-    // 1.a) Seed : choisir la meilleure requête initiale sur le ratio interest/time
-    int seed = -1;
-    double bestR = -1.0;
-    for (int i = 0; i < n; ++i) {
-        if (I.time[i] > I.epsilon_t) continue;  // Filtrer les requêtes impossibles dès le départ
-        double r = I.interest[i] / I.time[i];
-        if (r > bestR) {
-            bestR = r;
-            seed = i;
-        }
-    }
-    if (seed < 0) {
-        // Aucune requête n'est faisable, on retourne une solution vide
-        return path;
-    }
-    // Initialisation de la trajectoire avec le seed
-    path.push_back(seed);
-    used[seed] = true;
-    T = I.time[seed];
-
-    // 1.b) Insertion gloutonne : on recherche l'insertion offrant le meilleur gain au ratio
-    bool progress = true;
-    while (progress) {
-        progress = false;
-        int bestQ = -1;
-        int bestPos = -1;
-        double bestGain = -1.0;
-        double bestDT = 0.0, bestDD = 0.0;
-
-        // Tester chaque requête non utilisée
-        for (int q = 0; q < n; ++q) {
-            if (used[q]) continue;
-            // Tester toutes les positions d'insertion possibles
-            for (size_t pos = 0; pos <= path.size(); ++pos) {
-                double dd = delta_dist_ins(I, path, q, pos);
-                double dt = I.time[q];
-                // Vérifier la faisabilité après insertion
-                if (!feasible(T + dt, D + dd, I)) continue;
-                double cost = dt + dd + 1e-9; // Petite constante pour éviter div/0
-                double gain = I.interest[q] / cost;
-                if (gain > bestGain) {
-                    bestGain = gain;
-                    bestQ = q;
-                    bestPos = (int)pos;
-                    bestDT = dt;
-                    bestDD = dd;
-                }
-            }
-        }
-        if (bestQ != -1) {
-            // Insérer la meilleure requête trouvée
-            path.insert(path.begin() + bestPos, bestQ);
-            used[bestQ] = true;
-            T += bestDT;
-            D += bestDD;
-            progress = true;
-        }
-    }
+    std::vector<int>& path = P.nodes;
+    double T = P.time, D = P.dist;   // Temps et distance cumulés
 
     // 1.c) Amélioration locale 2-opt pour réduire la distance
-    bool improved = true;
-    while (improved) {
-        improved = false;
-        for (size_t i = 0; i + 2 < path.size() && !improved; ++i) {
-            for (size_t j = i + 2; j < path.size() && !improved; ++j) {
-                int a = path[i], b = path[i + 1];
-                int c = path[j - 1], d = path[j];
-                // Calculer variation si on échange [b..c]
-                double delta = I.dist[a][c] + I.dist[b][d] 
-                             - I.dist[a][b] - I.dist[c][d];
-                // Si amélioration et toujours faisable
-                if (delta < -1e-6 && feasible(T, D + delta, I)) {
-                    std::reverse(path.begin() + i + 1, path.begin() + j);
-                    D += delta;
-                    improved = true;
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::FastTwoOpt);
+        const bool symmetric = I.dist.symmetric();
+        RoutePrefix<DenseDistances> prefix(DenseDistances{I.dist}, path);
+        bool improved = true;
+        while (improved) {
+            improved = false;
+            TAP_STAT(++st.two_opt_passes);
+            for (size_t i = 0; i + 2 < path.size() && !improved; ++i) {
+                for (size_t j = i + 2; j < path.size() && !improved; ++j) {
+                    int a = path[i], b = path[i + 1];
+                    int c = path[j - 1], d = path[j];
+                    // Calculer variation si on échange [b..c]
+                    double delta = I.dist[a][c] + I.dist[b][d]
+                                 - I.dist[a][b] - I.dist[c][d];
+                    // Matrice asymétrique : les arcs intérieurs changent de sens
+                    if (!symmetric) delta += prefix.reversal_gap((int)i + 1, (int)j - 1);
+                    // Si amélioration et toujours faisable
+                    if (delta < -1e-6 && feasible(T, D + delta, I)) {
+                        std::reverse(path.begin() + i + 1, path.begin() + j);
+                        prefix.invalidate();
+                        D += delta;
+                        improved = true;
+                        TAP_STAT(++st.two_opt_moves);
+                    }
                 }
             }
         }
     }
 
     // 1.d) Append tail : essayer d'ajouter les requêtes restantes en fin de parcours
-    int last = path.back();
-    for (int q = 0; q < n; ++q) {
-        if (used[q]) continue;
-        double dd = I.dist[last][q];
-        double dt = I.time[q];
-        if (feasible(T + dt, D + dd, I)) {
-            path.push_back(q);
-            used[q] = true;
-            T += dt;
-            D += dd;
-            last = q;
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::FastTail);
+        int last = path.back();
+        for (int q = 0; q < n; ++q) {
+            if (P.used.test(q)) continue;
+            TAP_STAT(++st.candidates_scanned);
+            TAP_STAT(++st.insertion_evaluations);
+            double dd = I.dist[last][q];
+            double dt = I.time[q];
+            if (feasible(T + dt, D + dd, I)) {
+                path.push_back(q);
+                P.used.set(q);
+                T += dt;
+                D += dd;
+                last = q;
+            } else {
+                TAP_STAT(++st.feasibility_rejections);
+            }
         }
     }
-
-    return path;
+    P.time = T;
+    P.dist = D;
 }
 
 // -----------------------------------------------------------------------------
@@ -187,77 +418,36 @@ static std::vector<int> FastGreedy(const TapInstance& I) {
 //     Variante normalisée puis fallback sur baseline en cas de besoin
 // -----------------------------------------------------------------------------
 
-
-
-/**
- * @brief Représentation de chemin intermédiaire pour EnhancedGreedy.
- *
- * Stocke la trajectoire, les flags d'usage, et les métriques cumulées.
- */
-struct Path {
-    std::vector<int> nodes;         ///< Séquence de requêtes
-    std::vector<bool> used;         ///< Requêtes déjà insérées
-    double time = 0.0;              ///< Temps cumulé
-    double dist = 0.0;              ///< Distance cumulée
-    double reward = 0.0;            ///< Intérêt total accumulé
-    explicit Path(int n) : used(n, false) {}
-};
-
 /**
- * @brief Tente l'insertion "best-normalized-cost" de q dans P.
+ * @brief Tente la meilleure insertion de q dans P selon la politique.
  *
- * Calcule pour chaque position un score normalisé par epsilon.
  * Si insertion faisable, met à jour P et renvoie true.
  */
-static bool try_best_insert(
-    Path& P,
-    int q,
-    const TapInstance& I,
-    double wT,
-    double wD
-) {
-    size_t m = P.nodes.size();
-    size_t bestPos = m + 1;
-    double bestScore = -1.0;
-    double bestDT = 0.0, bestDD = 0.0;
-
+template <typename Policy>
+static bool try_best_insert(Path& P, int q, const TapInstance& I, const Policy& policy,
+                            SolverStats& st) {
     // Parcourir toutes les positions pour trouver la meilleure insertion
-    for (size_t pos = 0; pos <= m; ++pos) {
-        double dd = delta_dist_ins(I, P.nodes, q, pos);
-        double dt = I.time[q];
-        if (!feasible(P.time + dt, P.dist + dd, I)) continue;
-        double cost = dt * wT + dd * wD;
-        if (cost <= 0) cost = 1e-9;
-        double score = I.interest[q] / cost;
-        if (score > bestScore) {
-            bestScore = score;
-            bestPos = pos;
-            bestDT = dt;
-            bestDD = dd;
-        }
-    }
+    Insertion best;
+    scan_candidate(I, policy, P, best, q, I.interest[q], I.time[q], st);
 
     // Si une position valable a été trouvée, on insère
-    if (bestPos <= m) {
-        P.nodes.insert(P.nodes.begin() + bestPos, q);
-        P.used[q]   = true;
-        P.time     += bestDT;
-        P.dist     += bestDD;
-        P.reward   += I.interest[q];
-        return true;
-    }
-    return false;
+    if (best.q < 0) return false;
+    P.insert(q, best.pos, best.dt, best.dd, I.interest[q]);
+    return true;
 }
 
 /**
  * @brief Implémente la stratégie 2-opt sur le Path P.
  */
-static void two_opt(Path& P, const TapInstance& I) {
+static void two_opt(Path& P, const TapInstance& I, [[maybe_unused]] SolverStats& st) {
     int m = (int)P.nodes.size();
     if (m < 4) return;  // Pas assez de points pour 2-opt
+    const bool symmetric = I.dist.symmetric();
+    RoutePrefix<DenseDistances> prefix(DenseDistances{I.dist}, P.nodes);
     bool improved = true;
     while (improved) {
         improved = false;
+        TAP_STAT(++st.two_opt_passes);
         for (int i = 0; i < m - 3 && !improved; ++i) {
             for (int k = i + 2; k < m - 1 && !improved; ++k) {
                 int a = P.nodes[i], b = P.nodes[i + 1];
@@ -265,10 +455,13 @@ static void two_opt(Path& P, const TapInstance& I) {
                 double before = I.dist[a][b] + I.dist[c][d];
                 double after  = I.dist[a][c] + I.dist[b][d];
                 double delta  = after - before;
+                if (!symmetric) delta += prefix.reversal_gap(i + 1, k);
                 if (delta < -1e-9 && feasible(P.time, P.dist + delta, I)) {
                     std::reverse(P.nodes.begin() + i + 1, P.nodes.begin() + k + 1);
+                    prefix.invalidate();
                     P.dist += delta;
                     improved = true;
+                    TAP_STAT(++st.two_opt_moves);
                 }
             }
         }
@@ -278,10 +471,10 @@ static void two_opt(Path& P, const TapInstance& I) {
 /**
  * @brief Génère un chemin de fallback simple basé sur la baseline (tri par intérêt).
  */
-static Path baseline_path(const TapInstance& I) {
+static void baseline_path(const TapInstance& I, Path& B, std::vector<int>& idx) {
     int n = I.size;
-    Path B(n);
-    std::vector<int> idx(n);
+    B.clear(n);
+    idx.resize(n);
     std::iota(idx.begin(), idx.end(), 0);
     // Sorte par intérêt décroissant
     std::sort(idx.begin(), idx.end(), [&](int a, int b) {
@@ -292,7 +485,7 @@ static Path baseline_path(const TapInstance& I) {
         if (B.nodes.empty()) {
             if (I.time[q] <= I.epsilon_t) {
                 B.nodes.push_back(q);
-                B.used[q]   = true;
+                B.used.set(q);
                 B.time      = I.time[q];
                 B.reward    = I.interest[q];
             }
@@ -303,120 +496,120 @@ static Path baseline_path(const TapInstance& I) {
         double dd = I.dist[last][q];
         if (feasible(B.time + dt, B.dist + dd, I)) {
             B.nodes.push_back(q);
-            B.used[q]   = true;
+            B.used.set(q);
             B.time     += dt;
             B.dist     += dd;
             B.reward   += I.interest[q];
         }
     }
-    return B;
 }
 
 /**
- * @brief Implémente la version "EnhancedGreedy" de l'heuristique.
+ * @brief Termine la version "EnhancedGreedy" de l'heuristique.
+ *
+ * Après l'insertion normalisée commune (NormalizedScore), insère les
+ * requêtes restantes, applique un passage 2-opt, puis compare avec la
+ * baseline pour garantir un fallback performant.
  *
- * Normalise les coûts (temps vs distance), applique une boucle d'insertion,
- * un passage 2-opt, puis compare avec la baseline pour garantir un fallback performant.
+ * @return P, ou la baseline (ws.baseline) si elle est plus intéressante
  */
-static std::vector<int> EnhancedGreedy(const TapInstance& I) {
+static const Path& EnhancedGreedy(const TapInstance& I, Path& P, const NormalizedScore& policy,
+                                  GreedyWorkspace& ws, SolverStats& st) {
     const int n = I.size;
-    if (n == 0) return {};
 
-    // Coefficients pour normalisation des coûts
-    const double wT = 1.0 / I.epsilon_t;
-    const double wD = 1.0 / I.epsilon_d;
-
-    // Seed initial sur meilleur ratio intérêt/temps
-    int seed = 0;
-    double best = -1.0;
-    for (int i = 0; i < n; ++i) {
-        double s = I.interest[i] / I.time[i];
-        if (s > best) {
-            best = s;
-            seed = i;
-        }
-    }
-    Path P(n);
-    P.nodes.push_back(seed);
-    P.used[seed]  = true;
-    P.time        = I.time[seed];
-    P.reward      = I.interest[seed];
-
-    // Boucle principale d'insertion normalisée
-    bool progress = true;
-    while (progress) {
-        progress = false;
-        int bestQ = -1;
-        double bestScore = -1.0;
-        size_t bestPos = 0;
-        double bestDT = 0.0, bestDD = 0.0;
-        for (int q = 0; q < n; ++q) {
-            if (P.used[q]) continue;
-            size_t m = P.nodes.size();
-            for (size_t pos = 0; pos <= m; ++pos) {
-                double dd = delta_dist_ins(I, P.nodes, q, pos);
-                double dt = I.time[q];
-                if (!feasible(P.time + dt, P.dist + dd, I)) continue;
-                double cost = dt * wT + dd * wD;
-                if (cost <= 0) cost = 1e-9;
-                double score = I.interest[q] / cost;
-                if (score > bestScore) {
-                    bestScore = score;
-                    bestQ     = q;
-                    bestPos   = pos;
-                    bestDT    = dt;
-                    bestDD    = dd;
-                }
-            }
+    // Passage sur les requêtes restantes triées par intérêt décroissant
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::EnhancedRest);
+        std::vector<int>& rest = ws.order;
+        rest.clear();
+        for (int i = 0; i < n; ++i) {
+            if (!P.used.test(i)) rest.push_back(i);
         }
-        if (bestQ != -1) {
-            P.nodes.insert(P.nodes.begin() + bestPos, bestQ);
-            P.used[bestQ] = true;
-            P.time       += bestDT;
-            P.dist       += bestDD;
-            P.reward     += I.interest[bestQ];
-            progress      = true;
+        std::sort(rest.begin(), rest.end(), [&](int a, int b) {
+            return I.interest[a] > I.interest[b];
+        });
+        for (int q : rest) {
+            try_best_insert(P, q, I, policy, st);
         }
     }
 
-    // Passage sur les requêtes restantes triées par intérêt décroissant
-    std::vector<int> rest;
-    rest.reserve(n);
-    for (int i = 0; i < n; ++i) {
-        if (!P.used[i]) rest.push_back(i);
-    }
-    std::sort(rest.begin(), rest.end(), [&](int a, int b) {
-        return I.interest[a] > I.interest[b];
-    });
-    for (int q : rest) {
-        try_best_insert(P, q, I, wT, wD);
-    }
-
     // Amélioration 2-opt de la trajectoire
-    two_opt(P, I);
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::EnhancedTwoOpt);
+        two_opt(P, I, st);
+    }
 
     // Comparaison avec la baseline et fallback si nécessaire
-    Path B = baseline_path(I);
-    if (B.reward > P.reward) {
-        P = std::move(B);
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::EnhancedBaseline);
+        Path& B = ws.baseline;
+        baseline_path(I, B, ws.order);
+        if (B.reward > P.reward) {
+            TAP_STAT(st.baseline_fallback_won = true);
+            return B;
+        }
     }
 
-    return P.nodes;
+    return P;
 }
 
 // =============================================================================
 //  Public entry point – exécute les deux heuristiques et choisit la meilleure
 // =============================================================================
 
-std::vector<int> greedy_solve(const TapInstance& inst) {
-    // Exécution de FastGreedy
-    std::vector<int> path1 = FastGreedy(inst);
+const std::vector<int>& greedy_solve(const TapInstance& inst, SolverWorkspace& workspace,
+                                     SolverStats* stats, IncumbentTrace* trace) {
+    // Statistiques locales si l'appelant n'en demande pas
+    SolverStats local;
+    SolverStats& st = stats ? *stats : local;
+
+    const int n = inst.size;
+    GreedyWorkspace& ws = workspace.prepare(n).greedy;
+    const std::tuple<FastScore, NormalizedScore> policies{FastScore(inst), NormalizedScore(inst)};
+    Path& fast = ws.fast;
+    Path& enhanced = ws.enhanced;
+    fast.clear(n);
+    enhanced.clear(n);
+
+    // Requêtes de départ propres à chaque politique
+    bool fast_seeded, enhanced_seeded;
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::FastSeed);
+        fast_seeded = seed_path<FastScore>(inst, fast);
+    }
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::EnhancedSeed);
+        enhanced_seeded = seed_path<NormalizedScore>(inst, enhanced);
+    }
+
+    // Insertion gloutonne des deux heuristiques en un seul balayage par tour
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::GreedyInsertion);
+        fused_insertion(inst, policies, {&fast, &enhanced}, {fast_seeded, enhanced_seeded},
+                        ws, st);
+    }
+
+    // Fin de FastGreedy (aucune requête faisable : solution vide)
+    if (fast_seeded) FastGreedy(inst, fast, st);
+    const std::vector<int>& path1 = fast.nodes;
     double val1 = inst.solution_interest(path1);
+    if (trace) trace->record(val1, "FastGreedy");
 
-    // Exécution d'EnhancedGreedy
-    std::vector<int> path2 = EnhancedGreedy(inst);
+    // Fin d'EnhancedGreedy
+    const std::vector<int>& path2 = enhanced_seeded
+        ? EnhancedGreedy(inst, enhanced, std::get<NormalizedScore>(policies), ws, st).nodes
+        : enhanced.nodes;
     double val2 = inst.solution_interest(path2);
+    if (trace) trace->record(val2, "EnhancedGreedy");
+
+    // Retenir la solution la plus intéressante
+    ws.result.assign(val2 > val1 ? path2.begin() : path1.begin(),
+                     val2 > val1 ? path2.end() : path1.end());
+    st.workspace_bytes = std::max(st.workspace_bytes, workspace.capacity_bytes());
+    return ws.result;
+}
 
-    // Retourner la solution la plus intéressante
-    return (val2 > val1) ? path2 : path1;
+std::vector<int> greedy_solve(const TapInstance& inst, SolverStats* stats,
+                              IncumbentTrace* trace) {
+    return greedy_solve(inst, SolverWorkspace::local(), stats, trace);
 }
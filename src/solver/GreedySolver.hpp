@@ -2,6 +2,9 @@
 #define GREEDY_SOLVER_HPP
 
 #include "loaders/TapInstance.hpp"
+#include "solver/SolverStats.hpp"
+#include "solver/IncumbentTrace.hpp"
+#include "solver/SolverWorkspace.hpp"
 #include <vector>
 
 /**
@@ -9,8 +12,30 @@
  *        à l'aide d'une heuristique gloutonne.
  *
  * @param instance Référence constante à l'instance TAP à résoudre.
+ * @param stats    Si non nul, reçoit les compteurs et durées par phase
+ *                 de FastGreedy et EnhancedGreedy (cumulés à son contenu).
+ * @param trace    Si non nul, reçoit un événement horodaté à chaque
+ *                 amélioration de la meilleure solution.
  * @return Séquence d'indices de requêtes formant la solution gloutonne.
  */
-std::vector<int> greedy_solve(const TapInstance& instance);
+std::vector<int> greedy_solve(const TapInstance& instance,
+                              SolverStats* stats = nullptr,
+                              IncumbentTrace* trace = nullptr);
+
+/**
+ * @brief greedy_solve dans un espace de travail fourni par l'appelant.
+ *
+ * Tous les tampons (trajectoires, candidates, caches, solution) sont pris
+ * dans workspace : en régime établi, aucun appel n'alloue de mémoire. La
+ * version sans espace de travail utilise SolverWorkspace::local() et ne
+ * fait qu'une allocation, celle de la copie renvoyée.
+ *
+ * @param workspace Espace de travail (un seul thread à la fois)
+ * @return Solution, stockée dans workspace : valide jusqu'au prochain appel
+ */
+const std::vector<int>& greedy_solve(const TapInstance& instance,
+                                     SolverWorkspace& workspace,
+                                     SolverStats* stats = nullptr,
+                                     IncumbentTrace* trace = nullptr);
 
 #endif // GREEDY_SOLVER_HPP
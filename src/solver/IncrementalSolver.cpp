@@ -0,0 +1,369 @@
+#include "solver/IncrementalSolver.hpp"
+#include "solver/GreedySolver.hpp"
+#include "solver/RouteOps.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @file IncrementalSolver.cpp
+ * @brief Application de lots de mises à jour et réparation locale de la trajectoire
+ */
+
+namespace {
+
+/// Nombre maximal de balayages 2-opt après un lot (la trajectoire était déjà optimisée).
+constexpr int kTwoOptPasses = 2;
+
+/**
+ * @brief Meilleure position d'insertion de q dans P (moindre distance, faisable).
+ *
+ * @return P.size() + 1 si aucune position ne respecte epsilon_d
+ */
+size_t best_position(const TapInstance& I, const std::vector<int>& P, int q, double dist,
+                     double& bestDD) {
+    size_t bestPos = P.size() + 1;
+    bestDD = std::numeric_limits<double>::infinity();
+    for (size_t pos = 0; pos <= P.size(); ++pos) {
+        double dd = delta_dist_ins(I, P, q, pos);
+        if (dd < bestDD && dist + dd <= I.epsilon_d) {
+            bestDD = dd;
+            bestPos = pos;
+        }
+    }
+    return bestPos;
+}
+
+} // namespace
+
+QueryUpdate QueryUpdate::set_interest(int q, double v) {
+    QueryUpdate u;
+    u.kind = Kind::Interest;
+    u.query = q;
+    u.value = v;
+    return u;
+}
+
+QueryUpdate QueryUpdate::set_time(int q, double v) {
+    QueryUpdate u;
+    u.kind = Kind::Time;
+    u.query = q;
+    u.value = v;
+    return u;
+}
+
+QueryUpdate QueryUpdate::remove(int q) {
+    QueryUpdate u;
+    u.kind = Kind::Remove;
+    u.query = q;
+    return u;
+}
+
+QueryUpdate QueryUpdate::add(double interest, double time, std::vector<double> dist_out,
+                             std::vector<double> dist_in) {
+    QueryUpdate u;
+    u.kind = Kind::Add;
+    u.value = interest;
+    u.time = time;
+    u.dist_out = std::move(dist_out);
+    u.dist_in = std::move(dist_in);
+    return u;
+}
+
+IncrementalSolver::IncrementalSolver(TapInstance instance, std::vector<int> solution)
+    : instance_(std::move(instance)),
+      used_(instance_.size, 0),
+      active_(instance_.size, 1),
+      active_count_(instance_.size) {
+    if (instance_.backend != DistanceBackend::Dense) {
+        throw std::invalid_argument("IncrementalSolver: needs a dense distance matrix");
+    }
+    if (solution.empty()) {
+        resolve();
+        return;
+    }
+    for (int q : solution) {
+        if (q < 0 || q >= instance_.size || used_[q]) {
+            throw std::invalid_argument("IncrementalSolver: invalid initial solution");
+        }
+        used_[q] = 1;
+    }
+    route_ = std::move(solution);
+    time_ = instance_.solution_time(route_);
+    dist_ = instance_.solution_distance(route_);
+}
+
+void IncrementalSolver::resolve() {
+    resolve(SolverWorkspace::local());
+}
+
+void IncrementalSolver::resolve(SolverWorkspace& workspace) {
+    route_ = full_solve(workspace);
+    std::fill(used_.begin(), used_.end(), 0);
+    for (int q : route_) used_[q] = 1;
+    time_ = instance_.solution_time(route_);
+    dist_ = instance_.solution_distance(route_);
+}
+
+std::vector<int> IncrementalSolver::full_solve() const {
+    return full_solve(SolverWorkspace::local());
+}
+
+std::vector<int> IncrementalSolver::full_solve(SolverWorkspace& workspace) const {
+    std::vector<int> ids;
+    TapInstance sub = active_instance(ids);
+    std::vector<int> route;
+    for (int q : greedy_solve(sub, workspace)) route.push_back(ids[q]);
+
+    std::vector<char> used(instance_.size, 0);
+    for (int q : route) used[q] = 1;
+    double time = instance_.solution_time(route);
+    double dist = instance_.solution_distance(route);
+    repair_route(instance_, route, used, time, dist);
+    return route;
+}
+
+double IncrementalSolver::interest() const {
+    return instance_.solution_interest(route_);
+}
+
+TapInstance IncrementalSolver::active_instance(std::vector<int>& ids) const {
+    ids.clear();
+    ids.reserve(active_count_);
+    for (int q = 0; q < instance_.size; ++q) {
+        if (active_[q]) ids.push_back(q);
+    }
+    const int m = (int)ids.size();
+    std::vector<double> interest(m), time(m);
+    std::vector<std::vector<double>> dist(m, std::vector<double>(m));
+    for (int i = 0; i < m; ++i) {
+        interest[i] = instance_.interest[ids[i]];
+        time[i] = instance_.time[ids[i]];
+        const auto& row = instance_.dist[ids[i]];
+        for (int j = 0; j < m; ++j) dist[i][j] = row[ids[j]];
+    }
+    return TapInstance(instance_.filename, std::move(interest), std::move(time),
+                       std::move(dist), instance_.epsilon_t, instance_.epsilon_d);
+}
+
+bool IncrementalSolver::is_feasible(const std::vector<int>& sol) const {
+    std::vector<char> seen(instance_.size, 0);
+    for (int q : sol) {
+        if (q < 0 || q >= instance_.size || !active_[q] || seen[q]) return false;
+        seen[q] = 1;
+    }
+    return instance_.is_valid_solution(sol);
+}
+
+void IncrementalSolver::validate(const std::vector<QueryUpdate>& batch) const {
+    int n = instance_.size;
+    std::vector<char> active(active_);
+    for (const QueryUpdate& u : batch) {
+        if (u.kind == QueryUpdate::Kind::Add) {
+            if (u.dist_out.size() != (size_t)n
+                || (!u.dist_in.empty() && u.dist_in.size() != (size_t)n)) {
+                throw std::invalid_argument("QueryUpdate::Add: expected " + std::to_string(n)
+                                            + " distances");
+            }
+            if (u.time < 0.0) throw std::invalid_argument("QueryUpdate::Add: negative time");
+            active.push_back(1);
+            ++n;
+            continue;
+        }
+        if (u.query < 0 || u.query >= n || !active[u.query]) {
+            throw std::invalid_argument("QueryUpdate: unknown or removed query "
+                                        + std::to_string(u.query));
+        }
+        if (u.kind == QueryUpdate::Kind::Time && u.value < 0.0) {
+            throw std::invalid_argument("QueryUpdate::Time: negative time");
+        }
+        if (u.kind == QueryUpdate::Kind::Remove) active[u.query] = 0;
+    }
+}
+
+void IncrementalSolver::append_queries(const std::vector<QueryUpdate>& batch,
+                                       UpdateReport& report, std::vector<char>& touched) {
+    for (const QueryUpdate& u : batch) {
+        if (u.kind != QueryUpdate::Kind::Add) continue;
+        // Croissance en place : la matrice n'est recopiée qu'au premier ajout,
+        // tant qu'elle est partagée avec l'instance de départ
+        const int j = instance_.size;
+        instance_.dist.append(u.dist_out, u.dist_in.empty() ? u.dist_out : u.dist_in);
+        instance_.interest.push_back(u.value);
+        instance_.time.push_back(u.time);
+        if (!instance_.original_id.empty()) instance_.original_id.push_back(j);
+        ++instance_.size;
+        used_.push_back(0);
+        active_.push_back(1);
+        touched.push_back(1);
+        ++active_count_;
+        report.added_ids.push_back(j);
+    }
+}
+
+int IncrementalSolver::swap_in(int q) {
+    const TapInstance& I = instance_;
+    int bestPos = -1;
+    size_t bestIns = 0;
+    double bestGain = 0.0;
+    double bestDist = 0.0;
+    std::vector<int> rest;
+    rest.reserve(route_.size());
+    for (size_t pos = 0; pos < route_.size(); ++pos) {
+        const int r = route_[pos];
+        double gain = I.interest[q] - I.interest[r];
+        if (gain <= bestGain) continue;
+        if (time_ - I.time[r] + I.time[q] > I.epsilon_t) continue;
+        rest.assign(route_.begin(), route_.end());
+        double d = dist_ + delta_dist_rem(I, rest, pos);
+        rest.erase(rest.begin() + pos);
+        double dd;
+        size_t ins = best_position(I, rest, q, d, dd);
+        if (ins > rest.size()) continue;
+        bestGain = gain;
+        bestPos = (int)pos;
+        bestIns = ins;
+        bestDist = d + dd;
+    }
+    if (bestPos < 0) return 0;
+
+    const int r = route_[bestPos];
+    route_.erase(route_.begin() + bestPos);
+    route_.insert(route_.begin() + bestIns, q);
+    used_[r] = 0;
+    used_[q] = 1;
+    time_ += I.time[q] - I.time[r];
+    dist_ = bestDist;
+    return 1;
+}
+
+int IncrementalSolver::replace_member(int r) {
+    const TapInstance& I = instance_;
+    auto it = std::find(route_.begin(), route_.end(), r);
+    const size_t pos = (size_t)(it - route_.begin());
+    std::vector<int> rest(route_);
+    const double d = dist_ + delta_dist_rem(I, rest, pos);
+    const double t = time_ - I.time[r];
+    rest.erase(rest.begin() + pos);
+
+    int best = -1;
+    size_t bestIns = 0;
+    double bestDist = 0.0;
+    double bestInterest = I.interest[r];
+    for (int c = 0; c < I.size; ++c) {
+        if (!active_[c] || used_[c] || I.interest[c] <= bestInterest) continue;
+        if (t + I.time[c] > I.epsilon_t) continue;
+        double dd;
+        size_t ins = best_position(I, rest, c, d, dd);
+        if (ins > rest.size()) continue;
+        best = c;
+        bestIns = ins;
+        bestDist = d + dd;
+        bestInterest = I.interest[c];
+    }
+    if (best < 0) return 0;
+
+    rest.insert(rest.begin() + bestIns, best);
+    route_ = std::move(rest);
+    used_[r] = 0;
+    used_[best] = 1;
+    time_ = t + I.time[best];
+    dist_ = bestDist;
+    return 1;
+}
+
+std::vector<int> IncrementalSolver::free_candidates(const std::vector<char>& touched,
+                                                    bool all) const {
+    std::vector<int> cand;
+    for (int q = 0; q < instance_.size; ++q) {
+        if (active_[q] && !used_[q] && (all || touched[q])) cand.push_back(q);
+    }
+    // Même priorité que la construction gloutonne : intérêt par unité de temps
+    const auto& interest = instance_.interest;
+    const auto& time = instance_.time;
+    std::sort(cand.begin(), cand.end(), [&](int a, int b) {
+        return interest[a] * time[b] > interest[b] * time[a];
+    });
+    return cand;
+}
+
+UpdateReport IncrementalSolver::apply(const std::vector<QueryUpdate>& batch) {
+    auto start = std::chrono::steady_clock::now();
+    validate(batch);
+
+    UpdateReport report;
+    report.interest_before = interest();
+    std::vector<char> touched(instance_.size, 0);
+    append_queries(batch, report, touched);
+
+    // 1. Nouvelles valeurs et retraits
+    bool freed = !report.added_ids.empty();
+    std::vector<int> degraded;   // Membres de la trajectoire devenus moins rentables
+    for (const QueryUpdate& u : batch) {
+        if (u.kind == QueryUpdate::Kind::Add) {
+            ++report.applied;
+            continue;
+        }
+        const int q = u.query;
+        switch (u.kind) {
+        case QueryUpdate::Kind::Interest:
+            if (used_[q] && u.value < instance_.interest[q]) degraded.push_back(q);
+            instance_.interest[q] = u.value;
+            break;
+        case QueryUpdate::Kind::Time:
+            if (used_[q]) {
+                if (u.value > instance_.time[q]) degraded.push_back(q);
+                else freed = true;
+                time_ += u.value - instance_.time[q];
+            }
+            instance_.time[q] = u.value;
+            break;
+        case QueryUpdate::Kind::Remove:
+            if (used_[q]) {
+                auto it = std::find(route_.begin(), route_.end(), q);
+                size_t pos = (size_t)(it - route_.begin());
+                dist_ += delta_dist_rem(instance_, route_, pos);
+                time_ -= instance_.time[q];
+                route_.erase(it);
+                used_[q] = 0;
+                ++report.dropped;
+                freed = true;
+            }
+            active_[q] = 0;
+            --active_count_;
+            break;
+        case QueryUpdate::Kind::Add:
+            break;
+        }
+        touched[q] = 1;
+        ++report.applied;
+    }
+    if (route_.empty()) time_ = dist_ = 0.0;
+
+    // 2. Faisabilité
+    int repaired = repair_route(instance_, route_, used_, time_, dist_);
+    report.dropped += repaired;
+    if (repaired > 0) freed = true;
+
+    // 3. Échanges : requêtes touchées hors trajectoire, puis membres dégradés
+    for (int q : free_candidates(touched, false)) report.swaps += swap_in(q);
+    for (int r : degraded) {
+        if (used_[r]) report.swaps += replace_member(r);
+    }
+
+    // 4. 2-opt borné puis remplissage
+    if (report.dropped > 0 || report.swaps > 0) {
+        report.two_opt_moves = route_two_opt(instance_, route_, dist_, kTwoOptPasses);
+        if (report.two_opt_moves > 0) freed = true;
+    }
+    report.inserted = fill_route(instance_, route_, used_, time_, dist_,
+                                 free_candidates(touched, freed));
+
+    report.interest_after = interest();
+    report.elapsed_ms = std::chrono::duration<double, std::milli>(
+                            std::chrono::steady_clock::now() - start).count();
+    return report;
+}
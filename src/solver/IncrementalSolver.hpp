@@ -0,0 +1,149 @@
+#ifndef INCREMENTAL_SOLVER_HPP
+#define INCREMENTAL_SOLVER_HPP
+
+#include "loaders/TapInstance.hpp"
+#include "solver/SolverWorkspace.hpp"
+#include <vector>
+
+/**
+ * @brief Mise à jour d'une requête dans un flux de ré-estimations.
+ *
+ * Se construit avec les fonctions statiques : QueryUpdate::set_interest(q, v),
+ * set_time(q, v), remove(q), add(interest, time, dist_out, dist_in).
+ */
+struct QueryUpdate {
+    enum class Kind {
+        Interest,   ///< Nouvel intérêt de la requête query
+        Time,       ///< Nouveau temps d'exécution de la requête query
+        Add,        ///< Nouvelle requête (indice attribué = taille courante)
+        Remove      ///< Retrait de la requête query (l'indice n'est pas réutilisé)
+    };
+
+    Kind kind = Kind::Interest;
+    int query = -1;                  ///< Requête concernée (ignoré pour Add)
+    double value = 0.0;              ///< Intérêt ou temps (Interest/Time), intérêt (Add)
+    double time = 0.0;               ///< Temps de la nouvelle requête (Add)
+    std::vector<double> dist_out;    ///< Add : distances nouvelle -> requêtes existantes
+    std::vector<double> dist_in;     ///< Add : existantes -> nouvelle (vide = symétrique)
+
+    static QueryUpdate set_interest(int q, double v);
+    static QueryUpdate set_time(int q, double v);
+    static QueryUpdate remove(int q);
+    static QueryUpdate add(double interest, double time, std::vector<double> dist_out,
+                           std::vector<double> dist_in = {});
+};
+
+/**
+ * @brief Bilan d'un lot de mises à jour.
+ */
+struct UpdateReport {
+    int applied = 0;               ///< Mises à jour appliquées
+    int dropped = 0;               ///< Requêtes sorties de la trajectoire (retrait ou réparation)
+    int inserted = 0;              ///< Requêtes insérées
+    int swaps = 0;                 ///< Échanges requête sortante / entrante
+    int two_opt_moves = 0;         ///< Mouvements 2-opt
+    double interest_before = 0.0;  ///< Intérêt de la trajectoire avant le lot
+    double interest_after = 0.0;   ///< Intérêt de la trajectoire après le lot
+    double elapsed_ms = 0.0;       ///< Durée de apply()
+    std::vector<int> added_ids;    ///< Indices attribués aux requêtes ajoutées
+};
+
+/**
+ * @brief Ré-optimisation incrémentale d'une instance vivante.
+ *
+ * Garde une instance et sa trajectoire courante ; chaque lot de mises à
+ * jour est appliqué en place puis la trajectoire est corrigée localement,
+ * sans relancer greedy_solve :
+ *   1. les requêtes retirées quittent la trajectoire ;
+ *   2. si un budget est dépassé (temps ré-estimé à la hausse), repair_route
+ *      retire les requêtes les moins rentables ;
+ *   3. chaque requête touchée hors trajectoire tente un échange avec un
+ *      membre moins intéressant qu'elle peut remplacer, et chaque membre
+ *      dégradé (intérêt en baisse, temps en hausse) cherche un remplaçant
+ *      plus intéressant parmi les requêtes libres ;
+ *   4. 2-opt borné si la trajectoire a changé, puis remplissage : par les
+ *      seules requêtes touchées si aucun budget n'a été libéré, par toutes
+ *      les requêtes libres sinon.
+ *
+ * Coût d'un lot de k mises à jour sur une trajectoire de longueur L :
+ * O(k * (L^2 + n * L)) au pire, contre O(n^2 * L) pour une résolution
+ * complète. Les ajouts agrandissent la matrice en place (capacité
+ * amortie) ; elle n'est recopiée qu'une fois, tant qu'elle est partagée
+ * avec l'instance de départ.
+ * La qualité peut dériver par rapport à une résolution complète ;
+ * resolve() repart de greedy_solve quand on le souhaite.
+ *
+ * Les indices restent stables : une requête retirée garde son indice
+ * (inactive) et une requête ajoutée reçoit l'indice size.
+ */
+class IncrementalSolver {
+public:
+    /**
+     * @param instance Instance de départ (copiée ; la matrice reste partagée)
+     * @param solution Trajectoire de départ (vide = greedy_solve)
+     * @throws std::invalid_argument si l'instance n'a pas de matrice dense
+     */
+    explicit IncrementalSolver(TapInstance instance, std::vector<int> solution = {});
+
+    /**
+     * @brief Applique un lot de mises à jour et ré-optimise localement.
+     *
+     * @throws std::invalid_argument si une mise à jour est invalide (indice
+     *         hors bornes ou inactif, ligne de distances de mauvaise taille) ;
+     *         le lot est alors rejeté sans modification.
+     */
+    UpdateReport apply(const std::vector<QueryUpdate>& batch);
+
+    /// Résolution complète (full_solve) adoptée comme trajectoire courante.
+    void resolve();
+
+    /// resolve() dans un espace de travail fourni par l'appelant.
+    void resolve(SolverWorkspace& workspace);
+
+    /**
+     * @brief Résolution complète (greedy_solve) des seules requêtes actives.
+     *
+     * La trajectoire est ramenée aux indices de instance(), puis réparée
+     * (repair_route) si la construction gloutonne dépasse un budget : son
+     * départ n'est pas toujours filtré sur epsilon_t. La version sans
+     * espace de travail utilise SolverWorkspace::local().
+     */
+    std::vector<int> full_solve() const;
+
+    /// full_solve() dans un espace de travail fourni par l'appelant.
+    std::vector<int> full_solve(SolverWorkspace& workspace) const;
+
+    const TapInstance& instance() const { return instance_; }
+    const std::vector<int>& solution() const { return route_; }
+    bool is_active(int q) const { return active_[q] != 0; }
+    int active_count() const { return active_count_; }
+    double interest() const;
+
+    /**
+     * @brief Sous-instance des requêtes actives (matrice dense m x m).
+     *
+     * @param ids Reçoit l'indice dans instance() de chaque requête de la sous-instance
+     */
+    TapInstance active_instance(std::vector<int>& ids) const;
+
+    /// sol ne visite que des requêtes actives, chacune une fois, dans les budgets.
+    bool is_feasible(const std::vector<int>& sol) const;
+
+private:
+    void validate(const std::vector<QueryUpdate>& batch) const;
+    void append_queries(const std::vector<QueryUpdate>& batch, UpdateReport& report,
+                        std::vector<char>& touched);
+    int swap_in(int q);
+    int replace_member(int r);
+    std::vector<int> free_candidates(const std::vector<char>& touched, bool all) const;
+
+    TapInstance instance_;
+    std::vector<int> route_;
+    std::vector<char> used_;     ///< Appartenance à la trajectoire
+    std::vector<char> active_;   ///< Requête non retirée
+    int active_count_ = 0;
+    double time_ = 0.0;          ///< Temps courant de la trajectoire
+    double dist_ = 0.0;          ///< Distance courante de la trajectoire
+};
+
+#endif // INCREMENTAL_SOLVER_HPP
@@ -0,0 +1,87 @@
+#include "solver/IncumbentTrace.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+/**
+ * @file IncumbentTrace.cpp
+ * @brief Journal des solutions incumbentes et lecture/écriture des fichiers de trace
+ */
+
+void IncumbentTrace::restart() {
+    start_ = std::chrono::steady_clock::now();
+    events_.clear();
+}
+
+double IncumbentTrace::elapsed_ms() const {
+    auto elapsed = std::chrono::steady_clock::now() - start_;
+    return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+bool IncumbentTrace::record(double value, const char* source) {
+    if (!events_.empty() && value <= events_.back().value) return false;
+    events_.push_back(IncumbentEvent{elapsed_ms(), value, source});
+    return true;
+}
+
+bool append_incumbent_trace(const std::string& filename,
+                            const std::string& instance,
+                            const IncumbentTrace& trace) {
+    bool empty = true;
+    {
+        std::ifstream in(filename);
+        empty = !in || in.peek() == std::ifstream::traits_type::eof();
+    }
+    std::ofstream out(filename, std::ios::app);
+    if (!out) {
+        std::cerr << "Erreur : impossible d'écrire la trace '" << filename << "'\n";
+        return false;
+    }
+    if (empty) out << "instance;time_ms;value;source\n";
+    out << std::setprecision(12);
+    for (const auto& ev : trace.events()) {
+        out << instance << ";" << ev.time_ms << ";" << ev.value << ";" << ev.source << "\n";
+    }
+    return true;
+}
+
+std::unordered_map<std::string, std::vector<IncumbentEvent>>
+load_incumbent_trace(const std::string& filename) {
+    std::unordered_map<std::string, std::vector<IncumbentEvent>> result;
+    std::ifstream file(filename);
+    std::string line;
+
+    if (!file.is_open()) {
+        std::cerr << "Erreur : impossible d'ouvrir la trace '" << filename << "'\n";
+        return result;
+    }
+
+    // Lire et ignorer la ligne d'en-tête
+    std::getline(file, line);
+
+    while (std::getline(file, line)) {
+        std::istringstream iss(line);
+        std::string name, t_str, v_str, source;
+        if (!std::getline(iss, name, ';') || !std::getline(iss, t_str, ';')
+            || !std::getline(iss, v_str, ';')) {
+            std::cerr << "Avertissement : ligne mal formée -> '" << line << "'\n";
+            continue;
+        }
+        std::getline(iss, source, ';');
+        try {
+            result[name].push_back(IncumbentEvent{std::stod(t_str), std::stod(v_str), source});
+        } catch (const std::invalid_argument&) {
+            std::cerr << "Avertissement : valeur invalide -> '" << line << "'\n";
+        }
+    }
+
+    for (auto& [name, events] : result) {
+        std::stable_sort(events.begin(), events.end(),
+                         [](const IncumbentEvent& a, const IncumbentEvent& b) {
+                             return a.time_ms < b.time_ms;
+                         });
+    }
+    return result;
+}
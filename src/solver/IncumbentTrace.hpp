@@ -0,0 +1,74 @@
+#ifndef INCUMBENT_TRACE_HPP
+#define INCUMBENT_TRACE_HPP
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Amélioration de la meilleure solution connue au cours d'une résolution.
+ */
+struct IncumbentEvent {
+    double time_ms;        ///< Temps écoulé depuis le début de la résolution (ms)
+    double value;          ///< Intérêt total de la nouvelle meilleure solution
+    std::string source;    ///< Heuristique ayant produit la solution
+};
+
+/**
+ * @brief Journal horodaté des solutions incumbentes d'une résolution.
+ *
+ * Le chronomètre démarre à la construction (ou à restart()). record()
+ * n'ajoute un événement que si la valeur améliore strictement la
+ * précédente, pour que le journal décrive une courbe croissante.
+ */
+class IncumbentTrace {
+public:
+    IncumbentTrace() : start_(std::chrono::steady_clock::now()) {}
+
+    /// Remet le chronomètre à zéro et vide le journal.
+    void restart();
+
+    /// Temps écoulé depuis le début de la résolution (ms).
+    double elapsed_ms() const;
+
+    /**
+     * @brief Enregistre une solution si elle améliore l'incumbent.
+     *
+     * @return true si l'événement a été ajouté
+     */
+    bool record(double value, const char* source);
+
+    /// Meilleure valeur enregistrée (-1 si aucune).
+    double best() const { return events_.empty() ? -1.0 : events_.back().value; }
+
+    const std::vector<IncumbentEvent>& events() const { return events_; }
+
+private:
+    std::chrono::steady_clock::time_point start_;
+    std::vector<IncumbentEvent> events_;
+};
+
+/**
+ * @brief Écrit les événements d'une instance dans un fichier de trace.
+ *
+ * Format ';' comme les autres fichiers du projet, une ligne par événement :
+ *     instance;time_ms;value;source
+ * L'en-tête est écrit si le fichier est vide.
+ *
+ * @param filename Fichier de trace (ouvert en ajout)
+ * @param instance Nom de l'instance
+ * @param trace    Journal à écrire
+ * @return false si le fichier ne peut pas être ouvert
+ */
+bool append_incumbent_trace(const std::string& filename,
+                            const std::string& instance,
+                            const IncumbentTrace& trace);
+
+/**
+ * @brief Charge un fichier de trace : instance -> événements triés par temps.
+ */
+std::unordered_map<std::string, std::vector<IncumbentEvent>>
+load_incumbent_trace(const std::string& filename);
+
+#endif // INCUMBENT_TRACE_HPP
@@ -0,0 +1,376 @@
+#include "solver/MemeticSolver.hpp"
+#include "solver/FastRng.hpp"
+#include "solver/GreedySolver.hpp"
+#include "solver/Parallel.hpp"
+#include "solver/Population.hpp"
+#include "solver/RouteOps.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <string>
+
+/**
+ * @file MemeticSolver.cpp
+ * @brief Algorithme mémétique : croisement par ordre, réparation, mutation et recherche locale
+ */
+
+namespace {
+
+/// Tampons d'un thread de reproduction (SolverWorkspace).
+using Workspace = MemeticChild;
+
+/**
+ * @brief Données partagées (lecture seule) pendant une génération.
+ */
+struct Context {
+    const TapInstance& I;
+    const MemeticConfig& cfg;
+    const std::vector<int>& by_ratio;   ///< Requêtes par ratio intérêt / temps décroissant
+};
+
+/// Graine propre à un enfant : le résultat ne dépend pas de la répartition entre threads.
+std::uint64_t child_seed(std::uint64_t seed, long generation, int child) {
+    return seed ^ ((std::uint64_t)generation * 0x9E3779B97F4A7C15ull)
+                ^ ((std::uint64_t)(child + 1) * 0xC2B2AE3D27D4EB4Full);
+}
+
+double route_time(const TapInstance& I, const std::vector<int>& P) {
+    double T = 0.0;
+    for (int q : P) T += I.time[q];
+    return T;
+}
+
+double route_dist(const TapInstance& I, const std::vector<int>& P) {
+    double D = 0.0;
+    for (size_t k = 1; k < P.size(); ++k) D += I.dist[P[k - 1]][P[k]];
+    return D;
+}
+
+/// Remet used à 0 pour les requêtes de la trajectoire (préserve l'invariant).
+void release(Workspace& ws) {
+    for (int q : ws.route) ws.used[q] = 0;
+}
+
+/// 2-opt borné puis remplissage par ratio décroissant.
+void local_search(const Context& ctx, Workspace& ws, double& T, double& D) {
+    route_two_opt(ctx.I, ws.route, D, ctx.cfg.two_opt_passes);
+    fill_route(ctx.I, ws.route, ws.used, T, D, ctx.by_ratio);
+}
+
+/// Construction aléatoire : remplissage selon le ratio intérêt / temps bruité.
+void random_construction(const Context& ctx, Workspace& ws, FastRng& rng) {
+    const TapInstance& I = ctx.I;
+    for (int q = 0; q < I.size; ++q) {
+        double ratio = I.time[q] > 0 ? I.interest[q] / I.time[q] : I.interest[q] * 1e9;
+        ws.keys[q] = ratio * (0.25 + 1.5 * rng.uniform());
+        ws.order[q] = q;
+    }
+    std::sort(ws.order.begin(), ws.order.end(),
+              [&](int a, int b) { return ws.keys[a] > ws.keys[b]; });
+    ws.route.clear();
+    double T = 0.0, D = 0.0;
+    fill_route(I, ws.route, ws.used, T, D, ws.order);
+    local_search(ctx, ws, T, D);
+}
+
+/// Tournoi : meilleur de cfg.tournament individus tirés au hasard.
+int tournament(const Population& pop, int size, int k, FastRng& rng) {
+    int best = (int)rng.below((std::uint32_t)size);
+    for (int t = 1; t < k; ++t) {
+        int c = (int)rng.below((std::uint32_t)size);
+        if (pop.interest[c] > pop.interest[best]) best = c;
+    }
+    return best;
+}
+
+/**
+ * @brief Produit un enfant dans ws.route (faisable).
+ */
+void make_child(const Context& ctx, const Population& pop, Workspace& ws, FastRng& rng) {
+    const TapInstance& I = ctx.I;
+    const int P = pop.capacity();
+    const int k = std::max(1, ctx.cfg.tournament);
+    const int a = tournament(pop, P, k, rng);
+    int b = tournament(pop, P, k, rng);
+    if (b == a && P > 1) b = (a + 1 + (int)rng.below((std::uint32_t)(P - 1))) % P;
+
+    // Croisement par ordre : segment de a, puis les requêtes de b dans leur ordre
+    ws.route.clear();
+    const int* ga = pop.genes(a);
+    const int la = pop.length(a);
+    if (la > 0) {
+        int from = (int)rng.below((std::uint32_t)la);
+        int to = from + 1 + (int)rng.below((std::uint32_t)(la - from));
+        for (int k2 = from; k2 < to; ++k2) {
+            ws.route.push_back(ga[k2]);
+            ws.used[ga[k2]] = 1;
+        }
+    }
+    const int* gb = pop.genes(b);
+    const int lb = pop.length(b);
+    const int start = lb > 0 ? (int)rng.below((std::uint32_t)lb) : 0;
+    for (int k2 = 0; k2 < lb; ++k2) {
+        int q = gb[(start + k2) % lb];
+        if (ws.used[q]) continue;
+        ws.route.push_back(q);
+        ws.used[q] = 1;
+    }
+    double T = route_time(I, ws.route);
+    double D = route_dist(I, ws.route);
+    repair_route(I, ws.route, ws.used, T, D);
+
+    // Mutation : un coup des voisinages de la recherche locale
+    if (!ws.route.empty() && rng.uniform() < ctx.cfg.mutation_rate) {
+        const int L = (int)ws.route.size();
+        switch (rng.below(3)) {
+        case 0: {   // Retrait de 1 à 3 requêtes
+            int drops = 1 + (int)rng.below(3);
+            for (int d = 0; d < drops && !ws.route.empty(); ++d) {
+                size_t pos = rng.below((std::uint32_t)ws.route.size());
+                int q = ws.route[pos];
+                D += delta_dist_rem(I, ws.route, pos);
+                T -= I.time[q];
+                ws.used[q] = 0;
+                ws.route.erase(ws.route.begin() + pos);
+            }
+            break;
+        }
+        case 1: {   // Inversion d'un segment
+            int i = (int)rng.below((std::uint32_t)L);
+            int j = (int)rng.below((std::uint32_t)L);
+            if (i > j) std::swap(i, j);
+            std::reverse(ws.route.begin() + i, ws.route.begin() + j + 1);
+            D = route_dist(I, ws.route);
+            break;
+        }
+        default: {  // Échange sur place avec une requête libre
+            int pos = (int)rng.below((std::uint32_t)L);
+            for (int tries = 0; tries < 8; ++tries) {
+                int q = (int)rng.below((std::uint32_t)I.size);
+                if (ws.used[q]) continue;
+                int r = ws.route[pos];
+                if (pos > 0)     D += I.dist[ws.route[pos - 1]][q] - I.dist[ws.route[pos - 1]][r];
+                if (pos < L - 1) D += I.dist[q][ws.route[pos + 1]] - I.dist[r][ws.route[pos + 1]];
+                T += I.time[q] - I.time[r];
+                ws.used[r] = 0;
+                ws.used[q] = 1;
+                ws.route[pos] = q;
+                break;
+            }
+            break;
+        }
+        }
+        repair_route(I, ws.route, ws.used, T, D);
+    }
+
+    local_search(ctx, ws, T, D);
+}
+
+/// Individu exploitable : respecte les budgets (tolérance d'arrondi des sommes).
+bool feasible_member(const TapInstance& I, const Population& pop, int i) {
+    return pop.time[i] <= I.epsilon_t + 1e-6 && pop.dist[i] <= I.epsilon_d + 1e-6;
+}
+
+} // namespace
+
+std::vector<int> memetic_solve(const TapInstance& I, SolverWorkspace& workspace,
+                               const MemeticConfig& cfg, const std::vector<int>& initial,
+                               SolverStats* stats, IncumbentTrace* trace,
+                               Checkpointer* checkpoint, RaceLane* lane) {
+    const int n = I.size;
+    // Reprise : compteurs [génération], trajectoires [meilleure, parents...]
+    const Checkpoint* resumed = checkpoint ? checkpoint->resumed() : nullptr;
+    if (resumed && (resumed->counters.size() != 1 || resumed->routes.empty())) {
+        checkpoint->reject_resume("mal formé");
+        resumed = nullptr;
+    }
+    if (resumed && resumed->routes.size() != (std::size_t)cfg.population + 1) {
+        checkpoint->reject_resume("écrit pour une population de "
+                                  + std::to_string(resumed->routes.size() - 1) + " individus");
+        resumed = nullptr;
+    }
+    // Recherche terminée : prolongée seulement si les limites ont été relevées
+    if (resumed && resumed->finished
+        && ((cfg.time_limit_ms > 0 && resumed->elapsed_ms >= cfg.time_limit_ms)
+            || (cfg.generations > 0 && resumed->counters[0] >= cfg.generations))) {
+        checkpoint->mark_already_finished();
+        return resumed->routes[0];
+    }
+
+    std::vector<int> start = resumed         ? resumed->routes[0]
+                           : initial.empty() ? greedy_solve(I, workspace, stats, trace)
+                                             : initial;
+    if (n < 2 || cfg.population < 2) return start;
+    MemeticWorkspace& mw = workspace.prepare(n).memetic;
+
+    SolverStats local;
+    SolverStats& st = stats ? *stats : local;
+    // Le temps déjà consommé avant la reprise compte dans time_limit_ms
+    const auto t0 = std::chrono::steady_clock::now()
+        - std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+              std::chrono::duration<double, std::milli>(resumed ? resumed->elapsed_ms : 0.0));
+    auto elapsed_ms = [&]() {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0)
+            .count();
+    };
+
+    const int P = cfg.population;
+    const int threads = std::min(resolve_thread_count(cfg.threads), P);
+
+    std::vector<int>& by_ratio = mw.by_ratio;
+    by_ratio.resize(n);
+    for (int q = 0; q < n; ++q) by_ratio[q] = q;
+    std::sort(by_ratio.begin(), by_ratio.end(), [&](int a, int b) {
+        return I.interest[a] * I.time[b] > I.interest[b] * I.time[a];
+    });
+    const Context ctx{I, cfg, by_ratio};
+
+    FastRng seeder(cfg.seed);
+    std::vector<std::uint64_t>& zobrist = mw.zobrist;
+    zobrist.resize(n);
+    for (auto& z : zobrist) z = seeder.next();
+
+    // Mémoire prise une fois pour toute la recherche dans l'espace de travail
+    Population& parents = mw.parents;
+    Population& children = mw.children;
+    Population& survivors = mw.survivors;
+    parents.reset(P, n);
+    children.reset(P, n);
+    survivors.reset(P, n);
+    std::vector<Workspace>& workspaces = mw.threads;
+    if ((int)workspaces.size() < threads) workspaces.resize(threads);
+    for (int t = 0; t < threads; ++t) workspaces[t].clear(n);
+    std::vector<int>& ranking = mw.ranking;
+    std::vector<char>& taken = mw.taken;
+    ranking.resize(2 * P);
+    taken.resize(2 * P);
+    HashSet& kept = mw.kept;
+
+    // Répartit [0, P) en tranches contiguës, une par thread et son espace de travail
+    auto for_each_child = [&](auto&& f) {
+        parallel_for(threads, threads, [&](int t) {
+            const int lo = (int)((long)P * t / threads);
+            const int hi = (int)((long)P * (t + 1) / threads);
+            for (int c = lo; c < hi; ++c) f(c, workspaces[t]);
+        });
+    };
+
+    // Faisabilité du départ (solution fournie par l'appelant)
+    if (!resumed && !initial.empty()) {
+        Workspace& ws = workspaces[0];
+        for (int q : start) ws.used[q] = 1;
+        double T = I.solution_time(start), D = I.solution_distance(start);
+        repair_route(I, start, ws.used, T, D);
+        for (int q : start) ws.used[q] = 0;
+    }
+
+    std::vector<int> best = start;
+    double bestV = I.solution_interest(start);
+
+    long generation = 0;
+    auto snapshot = [&] {
+        Checkpoint cp;
+        cp.elapsed_ms = elapsed_ms();
+        cp.counters = {generation};
+        cp.routes.resize(P + 1);
+        cp.routes[0] = best;
+        for (int i = 0; i < P; ++i) parents.load(i, cp.routes[i + 1]);
+        return cp;
+    };
+
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::MemeticInit);
+        if (resumed) {
+            generation = (long)resumed->counters[0];
+            for (int i = 0; i < P; ++i) parents.store(i, resumed->routes[i + 1]);
+        } else {
+            parents.store(0, start);
+            for_each_child([&](int c, Workspace& ws) {
+                if (c == 0) return;
+                FastRng rng(child_seed(cfg.seed, 0, c));
+                random_construction(ctx, ws, rng);
+                parents.store(c, ws.route);
+                release(ws);
+            });
+        }
+        evaluate_population(I, parents, zobrist, 0, P, threads);
+    }
+
+    {
+        TAP_PHASE_TIMER(st, SolverPhase::MemeticEvolve);
+        while (cfg.generations <= 0 || generation < cfg.generations) {
+            if (cfg.time_limit_ms > 0 && elapsed_ms() >= cfg.time_limit_ms) break;
+            if (checkpoint && checkpoint->due()) checkpoint->submit(snapshot());
+            if (lane) {
+                if (!lane->yield(bestV, best)) break;
+                // L'incumbent global remplace le plus mauvais parent (la population
+                // initiale est dans l'ordre de construction, pas encore triée)
+                if (lane->import_better(bestV, best)) {
+                    bestV = I.solution_interest(best);
+                    const int worst = (int)(std::min_element(parents.interest.begin(),
+                                                             parents.interest.begin() + P)
+                                            - parents.interest.begin());
+                    parents.store(worst, best);
+                    evaluate_population(I, parents, zobrist, worst, worst + 1, 1);
+                }
+            }
+            ++generation;
+
+            for_each_child([&](int c, Workspace& ws) {
+                FastRng rng(child_seed(cfg.seed, generation, c));
+                make_child(ctx, parents, ws, rng);
+                children.store(c, ws.route);
+                release(ws);
+            });
+            evaluate_population(I, children, zobrist, 0, P, threads);
+
+            // Survivants : meilleurs parents et enfants, sans doublon d'ensemble
+            auto value = [&](int idx) {
+                const Population& pop = idx < P ? parents : children;
+                int i = idx < P ? idx : idx - P;
+                return feasible_member(I, pop, i) ? pop.interest[i]
+                                                  : -std::numeric_limits<double>::infinity();
+            };
+            for (int idx = 0; idx < 2 * P; ++idx) ranking[idx] = idx;
+            std::sort(ranking.begin(), ranking.end(),
+                      [&](int x, int y) { return value(x) > value(y); });
+            kept.clear();
+            std::fill(taken.begin(), taken.end(), 0);
+            int filled = 0;
+            for (int pass = 0; pass < 2 && filled < P; ++pass) {
+                for (int idx : ranking) {
+                    if (filled == P) break;
+                    if (taken[idx]) continue;
+                    const Population& pop = idx < P ? parents : children;
+                    int i = idx < P ? idx : idx - P;
+                    // Premier passage : individus distincts ; second : complète si besoin
+                    if (pass == 0 && !kept.insert(pop.hash[i])) continue;
+                    taken[idx] = 1;
+                    survivors.copy_from(filled++, pop, i);
+                }
+            }
+            std::swap(parents, survivors);
+
+            if (feasible_member(I, parents, 0) && parents.interest[0] > bestV + 1e-9) {
+                bestV = parents.interest[0];
+                parents.load(0, best);
+                if (trace) trace->record(bestV, "Memetic");
+            }
+        }
+    }
+
+    if (checkpoint) checkpoint->finish(snapshot());
+    TAP_STAT(st.memetic_generations += (std::uint64_t)generation);
+    TAP_STAT(st.memetic_children += (std::uint64_t)generation * P);
+    st.workspace_bytes = std::max(st.workspace_bytes, workspace.capacity_bytes());
+    return best;
+}
+
+std::vector<int> memetic_solve(const TapInstance& I, const MemeticConfig& cfg,
+                               const std::vector<int>& initial,
+                               SolverStats* stats, IncumbentTrace* trace,
+                               Checkpointer* checkpoint, RaceLane* lane) {
+    return memetic_solve(I, SolverWorkspace::local(), cfg, initial, stats, trace, checkpoint,
+                         lane);
+}
@@ -0,0 +1,96 @@
+#ifndef MEMETIC_SOLVER_HPP
+#define MEMETIC_SOLVER_HPP
+
+#include "loaders/TapInstance.hpp"
+#include "solver/Checkpoint.hpp"
+#include "solver/IncumbentTrace.hpp"
+#include "solver/RaceLane.hpp"
+#include "solver/SolverStats.hpp"
+#include "solver/SolverWorkspace.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Paramètres de l'algorithme mémétique.
+ */
+struct MemeticConfig {
+    int population = 32;           ///< Taille de la population
+    long generations = 0;          ///< Générations maximales (0 = pas de limite)
+    double time_limit_ms = 1000.0; ///< Limite de temps (0 = pas de limite)
+    double mutation_rate = 0.3;    ///< Probabilité de mutation d'un enfant
+    int tournament = 2;            ///< Taille du tournoi de sélection des parents
+    int two_opt_passes = 2;        ///< Balayages 2-opt de la recherche locale d'un enfant
+    int threads = 0;               ///< Threads de reproduction et d'évaluation (0 = nombre de cœurs)
+    std::uint64_t seed = 0;        ///< Graine (résultat indépendant du nombre de threads)
+};
+
+/**
+ * @brief Algorithme mémétique (génétique + recherche locale).
+ *
+ * Population initiale : la solution de départ (initial, à défaut la
+ * solution gloutonne) et des constructions par remplissage selon le ratio
+ * intérêt / temps bruité. À chaque génération, chaque enfant est produit
+ * indépendamment (en parallèle) :
+ *   1. deux parents choisis par tournoi ;
+ *   2. croisement par ordre : un segment du premier parent, complété par
+ *      les requêtes du second dans leur ordre, puis repair_route rétablit
+ *      les budgets ;
+ *   3. mutation (avec probabilité mutation_rate) : retraits, inversion de
+ *      segment ou échange avec une requête libre ;
+ *   4. recherche locale courte : 2-opt borné puis remplissage.
+ * Les enfants sont évalués par lots parallèles (evaluate_population), puis
+ * les meilleurs parents et enfants distincts (haché de leur ensemble de
+ * requêtes) forment la génération suivante.
+ *
+ * La mémoire de la population est prise une fois dans l'espace de
+ * travail : trois tampons (parents, enfants, survivants) de taille fixe
+ * et des tampons par thread de reproduction.
+ *
+ * Avec un Checkpointer, la meilleure solution, la population et le numéro
+ * de génération sont soumis entre deux générations. Les graines des
+ * enfants ne dépendant que de (seed, génération, enfant), une reprise
+ * poursuit exactement la même évolution.
+ *
+ * Avec un RaceLane (portfolio_solve), l'algorithme rend la main entre deux
+ * générations et remplace son plus mauvais parent par l'incumbent global
+ * quand celui-ci bat sa meilleure solution.
+ *
+ * @param instance Instance TAP
+ * @param cfg      Paramètres de l'algorithme
+ * @param initial  Solution de départ (vide = greedy_solve ; réparée si elle dépasse un budget)
+ * @param stats    Si non nul, reçoit les durées et le nombre de générations
+ * @param trace    Si non nul, reçoit les incumbents horodatés
+ * @param checkpoint Si non nul, sauvegardes périodiques et reprise éventuelle
+ * @param lane     Si non nul, exécution coopérative dans une course
+ * @return Meilleure séquence trouvée (faisable)
+ */
+std::vector<int> memetic_solve(const TapInstance& instance,
+                               const MemeticConfig& cfg = MemeticConfig(),
+                               const std::vector<int>& initial = {},
+                               SolverStats* stats = nullptr,
+                               IncumbentTrace* trace = nullptr,
+                               Checkpointer* checkpoint = nullptr,
+                               RaceLane* lane = nullptr);
+
+/**
+ * @brief memetic_solve dans un espace de travail fourni par l'appelant.
+ *
+ * Populations, tampons des threads de reproduction et tableaux de
+ * sélection sont pris dans workspace.memetic, la construction gloutonne
+ * dans workspace.greedy : en régime établi, seules les solutions renvoyées
+ * ou sauvegardées sont allouées. La version sans espace de travail utilise
+ * SolverWorkspace::local().
+ *
+ * @param workspace Espace de travail (un seul appel à la fois ; les threads
+ *                  de reproduction y ont chacun leurs tampons)
+ */
+std::vector<int> memetic_solve(const TapInstance& instance,
+                               SolverWorkspace& workspace,
+                               const MemeticConfig& cfg = MemeticConfig(),
+                               const std::vector<int>& initial = {},
+                               SolverStats* stats = nullptr,
+                               IncumbentTrace* trace = nullptr,
+                               Checkpointer* checkpoint = nullptr,
+                               RaceLane* lane = nullptr);
+
+#endif // MEMETIC_SOLVER_HPP
@@ -0,0 +1,47 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Nombre de threads à utiliser (0 = nombre de cœurs disponibles).
+ */
+inline int resolve_thread_count(int requested) {
+    if (requested > 0) return requested;
+    unsigned hw = std::thread::hardware_concurrency();
+    return hw == 0 ? 1 : (int)hw;
+}
+
+/**
+ * @brief Exécute f(i) pour i dans [0, count) sur plusieurs threads.
+ *
+ * Les indices sont distribués dynamiquement (compteur atomique), ce qui
+ * équilibre les tâches de durées inégales (sous-instances de tailles
+ * différentes). Avec un seul thread, la boucle s'exécute sur l'appelant.
+ *
+ * @param count   Nombre de tâches
+ * @param threads Nombre de threads (0 = nombre de cœurs)
+ * @param f       Fonction appelée avec l'indice de la tâche
+ */
+template <class F>
+void parallel_for(int count, int threads, F&& f) {
+    threads = std::min(resolve_thread_count(threads), count);
+    if (threads <= 1) {
+        for (int i = 0; i < count; ++i) f(i);
+        return;
+    }
+    std::atomic<int> next{0};
+    auto worker = [&]() {
+        for (int i = next.fetch_add(1); i < count; i = next.fetch_add(1)) f(i);
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (int t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (auto& th : pool) th.join();
+}
+
+#endif // PARALLEL_HPP
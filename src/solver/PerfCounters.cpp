@@ -0,0 +1,210 @@
+#include "solver/PerfCounters.hpp"
+#include <iomanip>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+/**
+ * @file PerfCounters.cpp
+ * @brief Lecture des compteurs matériels via perf_event_open (Linux)
+ *
+ * Chaque compteur est ouvert séparément (pas de groupe) afin qu'un compteur
+ * non supporté n'empêche pas la lecture des autres. Les lectures restent
+ * brutes ; les différences par phase sont corrigées du multiplexage
+ * (time_enabled / time_running de la phase).
+ */
+
+namespace {
+
+#ifdef __linux__
+/**
+ * @brief Descripteurs ouverts pour le thread courant (-1 = indisponible).
+ */
+struct ThreadCounters {
+    int fd[(int)PerfEvent::Count];
+    bool active = false;
+
+    ThreadCounters() {
+        for (int& f : fd) f = -1;
+    }
+    ~ThreadCounters() {
+        for (int f : fd) if (f >= 0) close(f);
+    }
+};
+
+thread_local ThreadCounters tls_counters;
+
+/**
+ * @brief Configuration perf_event_attr (type, config) de chaque compteur.
+ */
+void event_config(PerfEvent e, perf_event_attr& attr) {
+    auto& type = attr.type;
+    auto& config = attr.config;
+    auto cache = [](std::uint64_t id, std::uint64_t op, std::uint64_t result) {
+        return id | (op << 8) | (result << 16);
+    };
+    switch (e) {
+    case PerfEvent::Cycles:
+        type = PERF_TYPE_HARDWARE; config = PERF_COUNT_HW_CPU_CYCLES; break;
+    case PerfEvent::Instructions:
+        type = PERF_TYPE_HARDWARE; config = PERF_COUNT_HW_INSTRUCTIONS; break;
+    case PerfEvent::L1DMisses:
+        type = PERF_TYPE_HW_CACHE;
+        config = cache(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ,
+                       PERF_COUNT_HW_CACHE_RESULT_MISS);
+        break;
+    case PerfEvent::LLCMisses:
+        type = PERF_TYPE_HARDWARE; config = PERF_COUNT_HW_CACHE_MISSES; break;
+    case PerfEvent::DTLBMisses:
+        type = PERF_TYPE_HW_CACHE;
+        config = cache(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ,
+                       PERF_COUNT_HW_CACHE_RESULT_MISS);
+        break;
+    case PerfEvent::BranchMisses:
+        type = PERF_TYPE_HARDWARE; config = PERF_COUNT_HW_BRANCH_MISSES; break;
+    case PerfEvent::Count:
+        break;
+    }
+}
+
+int open_counter(PerfEvent e) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    event_config(e, attr);
+    attr.exclude_kernel = 1;   // Autorisé avec perf_event_paranoid <= 2
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // Compteur du thread appelant, sur n'importe quel CPU
+    long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    return (int)fd;
+}
+#endif
+
+} // namespace
+
+const char* perf_event_name(PerfEvent event) {
+    switch (event) {
+    case PerfEvent::Cycles:       return "cycles";
+    case PerfEvent::Instructions: return "instructions";
+    case PerfEvent::L1DMisses:    return "L1d-misses";
+    case PerfEvent::LLCMisses:    return "LLC-misses";
+    case PerfEvent::DTLBMisses:   return "dTLB-misses";
+    case PerfEvent::BranchMisses: return "branch-misses";
+    case PerfEvent::Count:        break;
+    }
+    return "?";
+}
+
+void PerfSample::accumulate(const PerfSample& begin, const PerfSample& end) {
+    for (int e = 0; e < (int)PerfEvent::Count; ++e) {
+        if (!begin.valid[e] || !end.valid[e]) continue;
+        valid[e] = true;
+        if (end.running[e] <= begin.running[e] || end.value[e] < begin.value[e]) continue;
+        // Extrapolation si le compteur a été multiplexé pendant la phase
+        const double raw = (double)(end.value[e] - begin.value[e]);
+        const double scale = (double)(end.enabled[e] - begin.enabled[e])
+                           / (double)(end.running[e] - begin.running[e]);
+        value[e] += (std::uint64_t)(raw * scale);
+    }
+}
+
+void PerfSample::add(const PerfSample& other) {
+    for (int e = 0; e < (int)PerfEvent::Count; ++e) {
+        if (!other.valid[e]) continue;
+        value[e] += other.value[e];
+        valid[e] = true;
+    }
+}
+
+bool PerfSample::any_valid() const {
+    for (bool v : valid) if (v) return true;
+    return false;
+}
+
+double PerfSample::ipc() const {
+    const int c = (int)PerfEvent::Cycles;
+    const int i = (int)PerfEvent::Instructions;
+    if (!valid[c] || !valid[i] || value[c] == 0) return -1.0;
+    return (double)value[i] / (double)value[c];
+}
+
+bool perf_counters_enable() {
+#ifdef __linux__
+    ThreadCounters& tc = tls_counters;
+    if (tc.active) return true;
+    for (int e = 0; e < (int)PerfEvent::Count; ++e) {
+        tc.fd[e] = open_counter((PerfEvent)e);
+        if (tc.fd[e] >= 0) tc.active = true;
+    }
+    return tc.active;
+#else
+    return false;
+#endif
+}
+
+bool perf_counters_active() {
+#ifdef __linux__
+    return tls_counters.active;
+#else
+    return false;
+#endif
+}
+
+void perf_counters_read(PerfSample& out) {
+#ifdef __linux__
+    const ThreadCounters& tc = tls_counters;
+    if (!tc.active) return;
+    for (int e = 0; e < (int)PerfEvent::Count; ++e) {
+        out.valid[e] = false;
+        if (tc.fd[e] < 0) continue;
+        std::uint64_t buf[3];   // valeur, time_enabled, time_running
+        if (read(tc.fd[e], buf, sizeof(buf)) != (ssize_t)sizeof(buf)) continue;
+        out.value[e] = buf[0];
+        out.enabled[e] = buf[1];
+        out.running[e] = buf[2];
+        out.valid[e] = true;
+    }
+#else
+    (void)out;
+#endif
+}
+
+void print_perf_sample(std::ostream& os, const PerfSample& s,
+                       std::uint64_t evaluations, const char* indent) {
+    if (!s.any_valid()) {
+        os << indent << "Compteurs matériels indisponibles\n";
+        return;
+    }
+    os << indent;
+    for (int e = 0; e < (int)PerfEvent::Count; ++e) {
+        os << perf_event_name((PerfEvent)e) << "=";
+        if (s.valid[e]) os << s.value[e];
+        else            os << "n/a";
+        os << " ";
+    }
+    os << "\n";
+
+    std::ios::fmtflags flags = os.flags();
+    std::streamsize prec = os.precision(3);
+    os << std::fixed;
+    double ipc = s.ipc();
+    os << indent << "IPC=";
+    if (ipc >= 0) os << ipc;
+    else          os << "n/a";
+    if (evaluations > 0) {
+        for (PerfEvent e : {PerfEvent::L1DMisses, PerfEvent::LLCMisses,
+                            PerfEvent::DTLBMisses, PerfEvent::BranchMisses}) {
+            if (!s.valid[(int)e]) continue;
+            os << " " << perf_event_name(e) << "/eval="
+               << (double)s.value[(int)e] / (double)evaluations;
+        }
+    }
+    os << "\n";
+    os.flags(flags);
+    os.precision(prec);
+}
@@ -0,0 +1,97 @@
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <cstdint>
+#include <ostream>
+
+/**
+ * @brief Compteurs matériels échantillonnés autour des phases du solveur.
+ */
+enum class PerfEvent : int {
+    Cycles = 0,     ///< Cycles CPU
+    Instructions,   ///< Instructions retirées
+    L1DMisses,      ///< Défauts de cache L1 données (lecture)
+    LLCMisses,      ///< Défauts de cache de dernier niveau
+    DTLBMisses,     ///< Défauts de TLB données (lecture)
+    BranchMisses,   ///< Branches mal prédites
+    Count
+};
+
+/**
+ * @brief Nom affichable d'un compteur.
+ */
+const char* perf_event_name(PerfEvent event);
+
+/**
+ * @brief Valeurs cumulées des compteurs matériels.
+ *
+ * Lu par perf_counters_read, un échantillon porte la valeur brute de chaque
+ * compteur et ses temps d'activation et d'exécution sur la PMU ; les
+ * échantillons accumulés ne portent que des valeurs corrigées du
+ * multiplexage. valid[e] est faux lorsque le compteur n'a pas pu être
+ * ouvert (noyau sans PMU exposée, conteneur, perf_event_paranoid trop
+ * strict...).
+ */
+struct PerfSample {
+    std::uint64_t value[(int)PerfEvent::Count] = {};
+    std::uint64_t enabled[(int)PerfEvent::Count] = {};   ///< time_enabled (lecture seulement)
+    std::uint64_t running[(int)PerfEvent::Count] = {};   ///< time_running (lecture seulement)
+    bool valid[(int)PerfEvent::Count] = {};
+
+    /**
+     * @brief Ajoute la différence (end - begin) de deux lectures à cet échantillon.
+     *
+     * La différence brute est extrapolée par le rapport des différences de
+     * temps (enabled / running) : le facteur de multiplexage de la phase,
+     * et non celui de chaque lecture depuis l'ouverture du compteur. Un
+     * compteur qui n'a pas tourné pendant la phase n'ajoute rien.
+     */
+    void accumulate(const PerfSample& begin, const PerfSample& end);
+
+    /**
+     * @brief Ajoute les compteurs valides d'un autre échantillon.
+     */
+    void add(const PerfSample& other);
+
+    /// true si au moins un compteur est valide
+    bool any_valid() const;
+
+    /// Instructions par cycle, ou -1 si indisponible
+    double ipc() const;
+};
+
+/**
+ * @brief Active la collecte des compteurs matériels pour le thread courant.
+ *
+ * Ouvre les descripteurs perf_event_open (espace utilisateur uniquement).
+ * Les compteurs indisponibles sont ignorés individuellement : la collecte
+ * se dégrade sans erreur, y compris hors Linux.
+ *
+ * @return true si au moins un compteur a pu être ouvert
+ */
+bool perf_counters_enable();
+
+/**
+ * @brief Indique si la collecte est active pour le thread courant.
+ */
+bool perf_counters_active();
+
+/**
+ * @brief Lit la valeur courante des compteurs du thread (non remis à zéro).
+ *
+ * @param out Échantillon rempli ; laissé invalide si la collecte est inactive
+ */
+void perf_counters_read(PerfSample& out);
+
+/**
+ * @brief Affiche un échantillon : valeurs brutes, IPC et défauts par évaluation.
+ *
+ * @param os          Flux de sortie
+ * @param sample      Échantillon à afficher
+ * @param evaluations Nombre d'évaluations d'insertion (0 = ne pas normaliser)
+ * @param indent      Préfixe de chaque ligne
+ */
+void print_perf_sample(std::ostream& os, const PerfSample& sample,
+                       std::uint64_t evaluations, const char* indent = "  ");
+
+#endif // PERF_COUNTERS_HPP
@@ -0,0 +1,94 @@
+#include "solver/Population.hpp"
+#include "solver/Parallel.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @file Population.cpp
+ * @brief Stockage contigu d'une population et évaluation par lots
+ */
+
+namespace {
+
+/// Individus par tâche : assez pour amortir la répartition entre threads.
+constexpr int kEvalBatch = 8;
+
+} // namespace
+
+Population::Population(int capacity, int genome_capacity)
+    : interest(capacity, 0.0),
+      time(capacity, 0.0),
+      dist(capacity, 0.0),
+      hash(capacity, 0),
+      genome_capacity_(genome_capacity),
+      genes_((std::size_t)capacity * genome_capacity, -1),
+      length_(capacity, 0) {}
+
+void Population::reset(int capacity, int genome_capacity) {
+    interest.assign(capacity, 0.0);
+    time.assign(capacity, 0.0);
+    dist.assign(capacity, 0.0);
+    hash.assign(capacity, 0);
+    genome_capacity_ = genome_capacity;
+    genes_.assign((std::size_t)capacity * genome_capacity, -1);
+    length_.assign(capacity, 0);
+}
+
+std::size_t Population::capacity_bytes() const {
+    return (interest.capacity() + time.capacity() + dist.capacity()) * sizeof(double)
+         + hash.capacity() * sizeof(std::uint64_t)
+         + (genes_.capacity() + length_.capacity()) * sizeof(int);
+}
+
+void Population::store(int i, const std::vector<int>& route) {
+    if ((int)route.size() > genome_capacity_) {
+        throw std::length_error("Population::store: route longer than genome capacity");
+    }
+    std::copy(route.begin(), route.end(), genes_.begin() + (std::size_t)i * genome_capacity_);
+    length_[i] = (int)route.size();
+}
+
+void Population::load(int i, std::vector<int>& route) const {
+    const int* g = genes(i);
+    route.assign(g, g + length_[i]);
+}
+
+void Population::copy_from(int i, const Population& src, int j) {
+    const int* g = src.genes(j);
+    std::copy(g, g + src.length_[j], genes_.begin() + (std::size_t)i * genome_capacity_);
+    length_[i] = src.length_[j];
+    interest[i] = src.interest[j];
+    time[i] = src.time[j];
+    dist[i] = src.dist[j];
+    hash[i] = src.hash[j];
+}
+
+void evaluate_population(const TapInstance& I, Population& pop,
+                         const std::vector<std::uint64_t>& zobrist,
+                         int begin, int end, int threads) {
+    const double* interest = I.interest.data();
+    const double* time = I.time.data();
+    const int batches = (end - begin + kEvalBatch - 1) / kEvalBatch;
+    parallel_for(batches, threads, [&](int b) {
+        const int lo = begin + b * kEvalBatch;
+        const int hi = std::min(end, lo + kEvalBatch);
+        for (int i = lo; i < hi; ++i) {
+            const int* g = pop.genes(i);
+            const int len = pop.length(i);
+            double V = 0.0, T = 0.0, D = 0.0;
+            std::uint64_t h = 0;
+            for (int k = 0; k < len; ++k) {
+                const int q = g[k];
+                V += interest[q];
+                T += time[q];
+                h ^= zobrist[q];
+                if (k > 0) D += I.dist[g[k - 1]][q];
+            }
+            pop.interest[i] = V;
+            pop.time[i] = T;
+            pop.dist[i] = D;
+            pop.hash[i] = h;
+        }
+    });
+}
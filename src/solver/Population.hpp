@@ -0,0 +1,78 @@
+#ifndef POPULATION_HPP
+#define POPULATION_HPP
+
+#include "loaders/TapInstance.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Population de trajectoires en mémoire contiguë (structure de tableaux).
+ *
+ * Les gènes de tous les individus sont rangés dans un seul tableau, chaque
+ * individu disposant d'un emplacement de genome_capacity requêtes ; les
+ * valeurs (intérêt, temps, distance, haché) sont dans des tableaux
+ * parallèles. Tout est alloué à la construction (ou par reset) : une
+ * génération ne fait que réécrire les emplacements.
+ */
+class Population {
+public:
+    /**
+     * @param capacity        Nombre d'individus
+     * @param genome_capacity Longueur maximale d'une trajectoire (n)
+     */
+    Population(int capacity, int genome_capacity);
+
+    /// Population vide, à dimensionner par reset() (tampons réutilisables, SolverWorkspace).
+    Population() : Population(0, 0) {}
+
+    /// Redimensionne à capacity individus vides (n'alloue que si la taille totale grandit).
+    void reset(int capacity, int genome_capacity);
+
+    /// Octets réservés.
+    std::size_t capacity_bytes() const;
+
+    int capacity() const { return (int)length_.size(); }
+
+    /// Gènes de l'individu i (length(i) requêtes valides).
+    const int* genes(int i) const { return genes_.data() + (std::size_t)i * genome_capacity_; }
+    int length(int i) const { return length_[i]; }
+
+    /// Écrit une trajectoire dans l'emplacement i (valeurs à réévaluer).
+    void store(int i, const std::vector<int>& route);
+
+    /// Relit l'individu i dans route (réutilise la capacité de route).
+    void load(int i, std::vector<int>& route) const;
+
+    /// Copie l'individu j de src (gènes et valeurs) dans l'emplacement i.
+    void copy_from(int i, const Population& src, int j);
+
+    std::vector<double> interest;       ///< Intérêt total de chaque individu
+    std::vector<double> time;           ///< Temps total
+    std::vector<double> dist;           ///< Distance totale
+    std::vector<std::uint64_t> hash;    ///< Haché de l'ensemble des requêtes (Zobrist)
+
+private:
+    int genome_capacity_;
+    std::vector<int> genes_;
+    std::vector<int> length_;
+};
+
+/**
+ * @brief Évalue les individus [begin, end) par lots parallèles.
+ *
+ * Remplit interest, time, dist et hash en un seul parcours des gènes,
+ * sans passer par TapInstance::solution_*.
+ *
+ * @param I       Instance TAP
+ * @param pop     Population à évaluer
+ * @param zobrist Clé de Zobrist de chaque requête (taille n)
+ * @param begin   Premier individu
+ * @param end     Fin (exclue)
+ * @param threads Nombre de threads (0 = nombre de cœurs)
+ */
+void evaluate_population(const TapInstance& I, Population& pop,
+                         const std::vector<std::uint64_t>& zobrist,
+                         int begin, int end, int threads);
+
+#endif // POPULATION_HPP
@@ -0,0 +1,191 @@
+#include "solver/PortfolioSolver.hpp"
+#include "solver/GreedySolver.hpp"
+#include "solver/Parallel.hpp"
+#include "solver/RaceLane.hpp"
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+
+/**
+ * @file PortfolioSolver.cpp
+ * @brief Ordonnancement par bandit des moteurs itératifs sous une échéance commune
+ */
+
+namespace {
+
+/// Moteur de la course : nom et résolution coopérative.
+struct Engine {
+    std::string name;
+    std::function<std::vector<int>(RaceLane&, SolverStats&)> run;
+};
+
+/**
+ * @brief Couloir à servir : score UCB1 maximal parmi les moteurs en attente.
+ *
+ * Un moteur jamais servi passe avant tous les autres (dans l'ordre des
+ * couloirs). Sinon, score = taux / meilleur taux + c * sqrt(ln N / n_i).
+ *
+ * @return Indice du couloir, -1 si aucun n'attend
+ */
+int pick_lane(const std::vector<std::unique_ptr<RaceLane>>& lanes, double exploration) {
+    long total = 0;
+    double top_rate = 0.0;
+    for (const auto& l : lanes) {
+        total += l->slices;
+        top_rate = std::max(top_rate, l->rate);
+    }
+    int chosen = -1;
+    double chosen_score = -std::numeric_limits<double>::infinity();
+    for (int k = 0; k < (int)lanes.size(); ++k) {
+        const RaceLane& l = *lanes[k];
+        if (l.running || l.finished || l.cancelled) continue;
+        if (l.slices == 0) return k;
+        double exploit = top_rate > 0.0 ? l.rate / top_rate : 0.0;
+        double score = exploit
+                     + exploration * std::sqrt(std::log((double)std::max(total, 1L)) / l.slices);
+        if (score > chosen_score) {
+            chosen_score = score;
+            chosen = k;
+        }
+    }
+    return chosen;
+}
+
+} // namespace
+
+double interest_upper_bound(const TapInstance& I) {
+    std::vector<int> order(I.size);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return I.interest[a] * I.time[b] > I.interest[b] * I.time[a];
+    });
+    double left = I.epsilon_t, bound = 0.0;
+    for (int q : order) {
+        if (I.time[q] > I.epsilon_t) continue;   // Ne tient dans aucune solution
+        if (I.time[q] <= left) {
+            bound += I.interest[q];
+            left -= I.time[q];
+        } else {
+            bound += I.interest[q] * left / I.time[q];
+            break;
+        }
+    }
+    return bound;
+}
+
+std::vector<int> portfolio_solve(const TapInstance& I, const PortfolioConfig& cfg,
+                                 SolverStats* stats, IncumbentTrace* trace) {
+    using Clock = RaceLane::Clock;
+    const auto t0 = Clock::now();
+    const auto deadline = t0 + std::chrono::duration_cast<Clock::duration>(
+                                   std::chrono::duration<double, std::milli>(cfg.time_limit_ms));
+    SolverStats local;
+    SolverStats& st = stats ? *stats : local;
+
+    std::vector<int> start = greedy_solve(I, &st, trace);
+    RaceControl control(trace);
+    control.incumbent.offer(start, I.solution_interest(start), "Greedy");
+    const double bound = interest_upper_bound(I);
+    auto proven = [&] { return control.incumbent.value() >= bound - 1e-9; };
+    if (I.size < 2 || proven()) {
+        TAP_STAT(st.portfolio_proven_optimal = proven());
+        return start;
+    }
+
+    // Moteurs : le temps est géré par l'ordonnanceur, un emplacement chacun
+    std::vector<Engine> engines;
+    for (int k = 0; k < cfg.tabu_engines; ++k) {
+        TabuConfig tc = cfg.tabu;
+        tc.time_limit_ms = 0.0;
+        tc.seed = cfg.tabu.seed + (std::uint64_t)k;
+        engines.push_back({"Tabu#" + std::to_string(k + 1),
+                           [&I, &start, tc](RaceLane& lane, SolverStats& s) {
+                               return tabu_search(I, tc, start, &s, nullptr, nullptr, &lane);
+                           }});
+    }
+    for (int k = 0; k < cfg.memetic_engines; ++k) {
+        MemeticConfig mc = cfg.memetic;
+        mc.time_limit_ms = 0.0;
+        mc.threads = 1;
+        mc.seed = cfg.memetic.seed + (std::uint64_t)k;
+        engines.push_back({"Memetic#" + std::to_string(k + 1),
+                           [&I, &start, mc](RaceLane& lane, SolverStats& s) {
+                               return memetic_solve(I, mc, start, &s, nullptr, nullptr, &lane);
+                           }});
+    }
+    if (engines.empty()) return start;
+
+    const int E = (int)engines.size();
+    const int slots = std::min(resolve_thread_count(cfg.threads), E);
+    const auto slice = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double, std::milli>(std::max(1.0, cfg.slice_ms)));
+    const double stall_ms = cfg.stall_fraction * cfg.time_limit_ms;
+
+    std::vector<std::unique_ptr<RaceLane>> lanes;
+    for (const Engine& e : engines) lanes.push_back(std::make_unique<RaceLane>(control, e.name));
+    std::vector<SolverStats> lane_stats(E);
+    std::vector<std::exception_ptr> errors(E);
+
+    // Un thread par moteur, mais au plus `slots` en tranche à la fois
+    std::vector<std::thread> workers;
+    workers.reserve(E);
+    for (int k = 0; k < E; ++k) {
+        workers.emplace_back([&, k] {
+            RaceLane& lane = *lanes[k];
+            std::vector<int> result;
+            try {
+                if (lane.start()) result = engines[k].run(lane, lane_stats[k]);
+            } catch (...) {
+                errors[k] = std::current_exception();
+            }
+            lane.finish(result, result.empty() ? -1.0 : I.solution_interest(result));
+        });
+    }
+
+    long stalled = 0;
+    {
+        std::unique_lock<std::mutex> lock(control.mutex);
+        for (;;) {
+            if (Clock::now() >= deadline || proven()) break;
+            // Moteurs en attente sans progrès : annulés, sauf le dernier en lice
+            int live = 0;
+            for (const auto& l : lanes) live += !l->finished && !l->cancelled;
+            for (auto& l : lanes) {
+                if (live > 1 && !l->running && !l->finished && !l->cancelled
+                    && l->slices > 0 && l->idle_ms >= stall_ms) {
+                    l->cancel();
+                    ++stalled;
+                    --live;
+                }
+            }
+            while (control.running < slots) {
+                int k = pick_lane(lanes, cfg.exploration);
+                if (k < 0) break;
+                lanes[k]->grant(std::min(Clock::now() + slice, deadline));
+            }
+            if (control.running == 0) break;   // Tous les moteurs terminés ou annulés
+            control.cv.wait_until(lock, std::min(Clock::now() + slice, deadline));
+        }
+        control.stop = true;
+        control.cv.notify_all();
+    }
+    for (auto& w : workers) w.join();
+    for (auto& e : errors) {
+        if (e) std::rethrow_exception(e);
+    }
+
+    for (int k = 0; k < E; ++k) {
+        st.merge(lane_stats[k]);
+        TAP_STAT(st.portfolio_slices += (std::uint64_t)lanes[k]->slices);
+    }
+    TAP_STAT(st.portfolio_stalled += (std::uint64_t)stalled);
+    TAP_STAT(st.portfolio_proven_optimal = proven());
+    (void)stalled;
+    return control.incumbent.route();
+}
@@ -0,0 +1,70 @@
+#ifndef PORTFOLIO_SOLVER_HPP
+#define PORTFOLIO_SOLVER_HPP
+
+#include "loaders/TapInstance.hpp"
+#include "solver/IncumbentTrace.hpp"
+#include "solver/MemeticSolver.hpp"
+#include "solver/SolverStats.hpp"
+#include "solver/TabuSearch.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Paramètres de la course entre solveurs.
+ */
+struct PortfolioConfig {
+    double time_limit_ms = 1000.0;  ///< Échéance globale (construction gloutonne comprise)
+    int threads = 0;                ///< Moteurs exécutés simultanément (0 = nombre de cœurs)
+    double slice_ms = 20.0;         ///< Durée d'une tranche de temps
+    double stall_fraction = 0.25;   ///< Arrêt d'un moteur sans amélioration pendant cette fraction de time_limit_ms
+    double exploration = 0.5;       ///< Poids de l'exploration du bandit (UCB1)
+    int tabu_engines = 2;           ///< Recherches tabou (graines distinctes)
+    int memetic_engines = 1;        ///< Algorithmes mémétiques (graines distinctes)
+    TabuConfig tabu;                ///< Paramètres des moteurs tabou (hors limite de temps)
+    MemeticConfig memetic;          ///< Paramètres des moteurs mémétiques (hors limite de temps et threads)
+};
+
+/**
+ * @brief Course entre solveurs sous une échéance commune.
+ *
+ * greedy_solve fournit la solution de départ, calculée une seule fois et
+ * passée à tous les moteurs. Les moteurs itératifs
+ * (tabu_search, memetic_solve) courent ensuite comme des tâches
+ * coopératives : au plus cfg.threads s'exécutent à la fois, chacun pendant
+ * une tranche de slice_ms, et rendent la main à leur point de coopération
+ * (RaceLane::yield). À chaque emplacement libre, l'ordonnanceur choisit le
+ * moteur de meilleur score UCB1 : taux d'amélioration récent (moyenne
+ * mobile, normalisé par le meilleur taux) plus un bonus d'exploration pour
+ * les moteurs peu servis.
+ *
+ * La meilleure solution est partagée : tabu repart de l'incumbent global à
+ * chaque diversification et n'accepte un coup tabou que s'il le bat,
+ * memetic l'injecte dans sa population à chaque génération.
+ * Un moteur sans amélioration propre pendant stall_fraction * time_limit_ms
+ * de son temps d'exécution est annulé (sauf s'il est le dernier en lice).
+ * Si l'incumbent atteint la borne supérieure (sac à dos fractionnaire sur
+ * le temps), il est optimal et toute la course s'arrête.
+ *
+ * Le résultat dépend de l'ordonnancement : deux exécutions peuvent
+ * différer.
+ *
+ * @param instance Instance TAP (matrice dense)
+ * @param cfg      Paramètres de la course et des moteurs
+ * @param stats    Si non nul, reçoit les compteurs cumulés de tous les moteurs
+ * @param trace    Si non nul, reçoit les incumbents horodatés (source : moteur)
+ * @return Meilleure séquence trouvée (faisable)
+ */
+std::vector<int> portfolio_solve(const TapInstance& instance,
+                                 const PortfolioConfig& cfg = PortfolioConfig(),
+                                 SolverStats* stats = nullptr,
+                                 IncumbentTrace* trace = nullptr);
+
+/**
+ * @brief Borne supérieure de l'intérêt d'une solution.
+ *
+ * Relaxation continue du budget de temps (sac à dos fractionnaire par
+ * intérêt / temps décroissant), la distance étant ignorée.
+ */
+double interest_upper_bound(const TapInstance& instance);
+
+#endif // PORTFOLIO_SOLVER_HPP
@@ -0,0 +1,149 @@
+#include "solver/QueryReordering.hpp"
+#include "loaders/DistanceProvider.hpp"
+#include "solver/Clustering.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+/**
+ * @file QueryReordering.cpp
+ * @brief Renumérotations des requêtes favorisant la réutilisation des lignes de cache
+ *
+ * Les accès dist[a][q] / dist[q][b] des boucles d'insertion et du 2-opt
+ * portent sur des requêtes proches dans la trajectoire, donc proches en
+ * distance. Renuméroter pour que les voisins aient des indices voisins
+ * regroupe ces lectures dans les mêmes lignes de cache.
+ *
+ * Les méthodes lisent une ligne de distances à la fois (D.row) et sont
+ * instanciées pour chaque représentation : sur un oracle, la ligne est
+ * calculée une fois et reste dans le cache du thread pendant son parcours.
+ */
+
+namespace {
+
+// Nombre de voisins du graphe utilisé par Cuthill-McKee
+constexpr int kNeighbours = 8;
+
+template <typename Dist>
+std::vector<int> cuthill_mckee(const Dist& D) {
+    const int n = D.size();
+    const int k = std::min(kNeighbours, n - 1);
+
+    // Graphe non orienté des k plus proches voisins
+    std::vector<std::vector<int>> adj(n);
+    std::vector<int> cand(n);
+    for (int i = 0; i < n; ++i) {
+        const auto* row = D.row(i);
+        std::iota(cand.begin(), cand.end(), 0);
+        std::swap(cand[i], cand[n - 1]);  // exclure i
+        std::nth_element(cand.begin(), cand.begin() + k, cand.end() - 1, [&](int a, int b) {
+            return row[a] < row[b];
+        });
+        for (int j = 0; j < k; ++j) {
+            adj[i].push_back(cand[j]);
+            adj[cand[j]].push_back(i);
+        }
+    }
+    for (auto& nb : adj) {
+        std::sort(nb.begin(), nb.end());
+        nb.erase(std::unique(nb.begin(), nb.end()), nb.end());
+    }
+    auto degree_less = [&](int a, int b) {
+        return adj[a].size() < adj[b].size() || (adj[a].size() == adj[b].size() && a < b);
+    };
+    for (auto& nb : adj) std::sort(nb.begin(), nb.end(), degree_less);
+
+    // Parcours en largeur depuis le sommet de plus faible degré de chaque composante
+    std::vector<int> by_degree(n);
+    std::iota(by_degree.begin(), by_degree.end(), 0);
+    std::sort(by_degree.begin(), by_degree.end(), degree_less);
+    std::vector<char> visited(n, 0);
+    std::vector<int> order;
+    order.reserve(n);
+    for (int start : by_degree) {
+        if (visited[start]) continue;
+        size_t head = order.size();
+        order.push_back(start);
+        visited[start] = 1;
+        while (head < order.size()) {
+            int v = order[head++];
+            for (int w : adj[v]) {
+                if (!visited[w]) {
+                    visited[w] = 1;
+                    order.push_back(w);
+                }
+            }
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+template <typename Dist>
+std::vector<int> nearest_neighbour_chain(const Dist& D) {
+    const int n = D.size();
+    std::vector<char> visited(n, 0);
+    std::vector<int> order;
+    order.reserve(n);
+    int cur = 0;
+    for (int step = 0; step < n; ++step) {
+        order.push_back(cur);
+        visited[cur] = 1;
+        int next = -1;
+        double bestD = std::numeric_limits<double>::infinity();
+        const auto* row = D.row(cur);
+        for (int j = 0; j < n; ++j) {
+            if (!visited[j] && row[j] < bestD) {
+                bestD = row[j];
+                next = j;
+            }
+        }
+        if (next < 0) break;
+        cur = next;
+    }
+    return order;
+}
+
+template <typename Dist>
+std::vector<int> cluster_order(const TapInstance& I, const Dist& D, int threads) {
+    const int k = std::max(1, (int)std::lround(std::sqrt((double)I.size)));
+    Clustering C = k_medoids(I, k, 10, 0, threads);
+    std::vector<int> order;
+    order.reserve(I.size);
+    for (int c : order_clusters(I, C)) {
+        std::vector<int> mem = C.members[c];
+        const auto* row = D.row(C.medoids[c]);
+        std::stable_sort(mem.begin(), mem.end(), [&](int a, int b) { return row[a] < row[b]; });
+        order.insert(order.end(), mem.begin(), mem.end());
+    }
+    return order;
+}
+
+} // namespace
+
+ReorderMethod parse_reorder_method(const std::string& name) {
+    if (name == "none")    return ReorderMethod::None;
+    if (name == "rcm")     return ReorderMethod::CuthillMcKee;
+    if (name == "nn")      return ReorderMethod::NearestNeighbour;
+    if (name == "cluster") return ReorderMethod::Cluster;
+    throw std::invalid_argument("Unknown reordering method: " + name);
+}
+
+std::vector<int> compute_locality_order(const TapInstance& I, ReorderMethod method, int threads) {
+    if (I.size <= 1 || method == ReorderMethod::None) {
+        std::vector<int> identity(I.size);
+        std::iota(identity.begin(), identity.end(), 0);
+        return identity;
+    }
+    return visit_distances(I, [&](const auto& D) -> std::vector<int> {
+        switch (method) {
+        case ReorderMethod::CuthillMcKee:     return cuthill_mckee(D);
+        case ReorderMethod::NearestNeighbour: return nearest_neighbour_chain(D);
+        case ReorderMethod::Cluster:          return cluster_order(I, D, threads);
+        case ReorderMethod::None:             break;
+        }
+        return {};
+    });
+}
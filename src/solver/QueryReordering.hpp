@@ -0,0 +1,36 @@
+#ifndef QUERY_REORDERING_HPP
+#define QUERY_REORDERING_HPP
+
+#include "loaders/TapInstance.hpp"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Méthode de renumérotation des requêtes pour la localité mémoire.
+ */
+enum class ReorderMethod {
+    None,              ///< Ordre du fichier
+    CuthillMcKee,      ///< Reverse Cuthill-McKee sur le graphe des k plus proches voisins
+    NearestNeighbour,  ///< Chaîne du plus proche voisin
+    Cluster            ///< Groupes k-medoids consécutifs, triés par distance au medoid
+};
+
+/**
+ * @brief Analyse le nom d'une méthode ("none", "rcm", "nn", "cluster").
+ *
+ * @throws std::invalid_argument si le nom n'est pas reconnu
+ */
+ReorderMethod parse_reorder_method(const std::string& name);
+
+/**
+ * @brief Calcule un ordre des requêtes qui rapproche en mémoire les requêtes voisines.
+ *
+ * @param I       Instance TAP
+ * @param method  Méthode de renumérotation
+ * @param threads Nombre de threads pour la méthode Cluster (0 = nombre de cœurs)
+ * @return Permutation new -> old, à passer à TapInstance::apply_permutation()
+ */
+std::vector<int> compute_locality_order(const TapInstance& I, ReorderMethod method,
+                                        int threads = 0);
+
+#endif // QUERY_REORDERING_HPP
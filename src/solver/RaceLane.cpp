@@ -0,0 +1,111 @@
+#include "solver/RaceLane.hpp"
+
+#include <algorithm>
+
+/**
+ * @file RaceLane.cpp
+ * @brief Incumbent partagé et tranches de temps des moteurs d'une course
+ */
+
+namespace {
+
+/// Poids de la dernière tranche dans la moyenne mobile du taux d'amélioration.
+constexpr double kRateSmoothing = 0.5;
+
+} // namespace
+
+bool SharedIncumbent::offer(const std::vector<int>& route, double value, const char* source) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (value <= value_.load(std::memory_order_relaxed) + 1e-9) return false;
+    route_ = route;
+    value_.store(value, std::memory_order_release);
+    if (trace_) trace_->record(value, source);
+    return true;
+}
+
+bool SharedIncumbent::fetch_if_better(double than, std::vector<int>& out) const {
+    if (value() <= than + 1e-9) return false;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (value_.load(std::memory_order_relaxed) <= than + 1e-9) return false;
+    out = route_;
+    return true;
+}
+
+std::vector<int> SharedIncumbent::route() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return route_;
+}
+
+bool RaceLane::start() {
+    std::unique_lock<std::mutex> lock(control_.mutex);
+    return wait_grant(lock);
+}
+
+bool RaceLane::yield(double value, const std::vector<int>& best) {
+    if (reported_ < 0.0) {
+        // Premier appel : solution de départ du moteur, pas une amélioration
+        reported_ = value;
+        control_.incumbent.offer(best, value, name_.c_str());
+    } else if (value > reported_ + 1e-9) {
+        gain_ += value - reported_;
+        reported_ = value;
+        control_.incumbent.offer(best, value, name_.c_str());
+    }
+    if (control_.stop.load(std::memory_order_relaxed)) return false;
+    if (Clock::now() < slice_end_) return true;
+
+    std::unique_lock<std::mutex> lock(control_.mutex);
+    end_slice();
+    return wait_grant(lock);
+}
+
+bool RaceLane::import_better(double value, std::vector<int>& out) {
+    if (!control_.incumbent.fetch_if_better(value, out)) return false;
+    reported_ = std::max(reported_, control_.incumbent.value());
+    return true;
+}
+
+void RaceLane::finish(const std::vector<int>& route, double value) {
+    if (!route.empty()) control_.incumbent.offer(route, value, name_.c_str());
+    std::lock_guard<std::mutex> lock(control_.mutex);
+    if (value > reported_ + 1e-9 && reported_ >= 0.0) gain_ += value - reported_;
+    if (running) end_slice();
+    best = std::max(best, value);
+    finished = true;
+    control_.cv.notify_all();
+}
+
+void RaceLane::grant(Clock::time_point until) {
+    granted_ = true;
+    until_ = until;
+    running = true;
+    ++control_.running;
+    control_.cv.notify_all();
+}
+
+void RaceLane::cancel() {
+    cancelled = true;
+    control_.cv.notify_all();
+}
+
+bool RaceLane::wait_grant(std::unique_lock<std::mutex>& lock) {
+    control_.cv.wait(lock, [&] { return granted_ || cancelled || control_.stop.load(); });
+    if (cancelled || control_.stop.load()) return false;
+    granted_ = false;
+    slice_start_ = Clock::now();
+    slice_end_ = until_;
+    return true;
+}
+
+void RaceLane::end_slice() {
+    double dt = std::chrono::duration<double, std::milli>(Clock::now() - slice_start_).count();
+    run_ms += dt;
+    ++slices;
+    rate = kRateSmoothing * (gain_ / std::max(dt, 1e-3)) + (1.0 - kRateSmoothing) * rate;
+    idle_ms = gain_ > 0.0 ? 0.0 : idle_ms + dt;
+    best = std::max(best, reported_);
+    gain_ = 0.0;
+    running = false;
+    --control_.running;
+    control_.cv.notify_all();
+}
@@ -0,0 +1,145 @@
+#ifndef RACE_LANE_HPP
+#define RACE_LANE_HPP
+
+#include "solver/IncumbentTrace.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Meilleure solution connue, partagée par les moteurs d'une course.
+ *
+ * La valeur se lit sans verrou : un moteur la consulte à chaque point de
+ * coopération, et ne copie la trajectoire que si elle bat la sienne.
+ */
+class SharedIncumbent {
+public:
+    /// @param trace Journal des améliorations (optionnel, écrit sous verrou)
+    explicit SharedIncumbent(IncumbentTrace* trace = nullptr) : trace_(trace) {}
+
+    /**
+     * @brief Propose une solution faisable.
+     *
+     * @return true si elle devient l'incumbent (amélioration stricte)
+     */
+    bool offer(const std::vector<int>& route, double value, const char* source);
+
+    /// Valeur de l'incumbent (-1 si aucune solution).
+    double value() const { return value_.load(std::memory_order_acquire); }
+
+    /// Copie l'incumbent dans out s'il bat strictement than.
+    bool fetch_if_better(double than, std::vector<int>& out) const;
+
+    /// Copie de l'incumbent.
+    std::vector<int> route() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::atomic<double> value_{-1.0};
+    std::vector<int> route_;
+    IncumbentTrace* trace_;
+};
+
+/**
+ * @brief État commun à l'ordonnanceur et aux moteurs d'une course.
+ */
+struct RaceControl {
+    explicit RaceControl(IncumbentTrace* trace = nullptr) : incumbent(trace) {}
+
+    SharedIncumbent incumbent;
+    std::mutex mutex;                  ///< Protège les champs d'ordonnancement des couloirs
+    std::condition_variable cv;        ///< Fin de tranche, fin de moteur, tranche accordée
+    std::atomic<bool> stop{false};     ///< Échéance atteinte ou optimum prouvé
+    int running = 0;                   ///< Moteurs en cours de tranche
+};
+
+/**
+ * @brief Couloir d'un moteur dans une course (portfolio_solve).
+ *
+ * Le moteur ne s'exécute que pendant les tranches que lui accorde
+ * l'ordonnanceur. Il appelle yield() régulièrement (entre deux itérations,
+ * comme Checkpointer::due()) : yield() publie sa meilleure solution dans
+ * l'incumbent partagé et, la tranche écoulée, rend la main puis attend la
+ * suivante. L'amélioration obtenue pendant la tranche (par le moteur
+ * lui-même, pas par import) alimente le bandit de l'ordonnanceur.
+ *
+ * Les champs publics sont ceux de l'ordonnanceur : ils ne se lisent et ne
+ * s'écrivent que sous control.mutex.
+ */
+class RaceLane {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    RaceLane(RaceControl& control, std::string name)
+        : control_(control), name_(std::move(name)) {}
+
+    RaceLane(const RaceLane&) = delete;
+    RaceLane& operator=(const RaceLane&) = delete;
+
+    const std::string& name() const { return name_; }
+
+    // --- Côté moteur ---
+
+    /// Attend la première tranche ; false si la course s'est terminée avant.
+    bool start();
+
+    /**
+     * @brief Point de coopération.
+     *
+     * @param value Valeur de la meilleure solution du moteur
+     * @param best  Meilleure solution du moteur (faisable)
+     * @return false si le moteur doit s'arrêter (annulé, échéance, optimum prouvé)
+     */
+    bool yield(double value, const std::vector<int>& best);
+
+    /**
+     * @brief Copie l'incumbent global dans out s'il bat value.
+     *
+     * La solution importée devient la référence du moteur : elle ne compte
+     * pas comme une amélioration de sa part.
+     */
+    bool import_better(double value, std::vector<int>& out);
+
+    /// Valeur de l'incumbent global (lecture sans verrou).
+    double global_best() const { return control_.incumbent.value(); }
+
+    /// Fin du moteur : publie sa solution et libère son emplacement.
+    void finish(const std::vector<int>& best, double value);
+
+    // --- Côté ordonnanceur (sous control.mutex) ---
+
+    /// Accorde une tranche jusqu'à until.
+    void grant(Clock::time_point until);
+
+    /// Annule un moteur en attente de tranche.
+    void cancel();
+
+    bool running = false;       ///< Tranche en cours
+    bool finished = false;      ///< Moteur terminé (de lui-même ou après annulation)
+    bool cancelled = false;     ///< Arrêté par l'ordonnanceur
+    long slices = 0;            ///< Tranches achevées
+    double run_ms = 0.0;        ///< Temps d'exécution cumulé
+    double idle_ms = 0.0;       ///< Temps d'exécution depuis sa dernière amélioration
+    double rate = 0.0;          ///< Amélioration par ms, moyenne mobile des tranches récentes
+    double best = -1.0;         ///< Meilleure valeur du moteur
+
+private:
+    bool wait_grant(std::unique_lock<std::mutex>& lock);
+    void end_slice();
+
+    RaceControl& control_;
+    std::string name_;
+    bool granted_ = false;
+    Clock::time_point until_;
+
+    // Propres au thread du moteur
+    Clock::time_point slice_start_;
+    Clock::time_point slice_end_;
+    double reported_ = -1.0;    ///< Dernière valeur publiée
+    double gain_ = 0.0;         ///< Amélioration propre depuis le début de la tranche
+};
+
+#endif // RACE_LANE_HPP
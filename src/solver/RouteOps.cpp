@@ -0,0 +1,140 @@
+#include "solver/RouteOps.hpp"
+#include <algorithm>
+#include <limits>
+
+/**
+ * @file RouteOps.cpp
+ * @brief 2-opt, réparation et remplissage de trajectoires pour les solveurs composés
+ *
+ * Les modèles sont définis ici et instanciés en fin de fichier pour les
+ * trois vues de distances.
+ */
+
+template <typename Dist>
+int route_two_opt(const Dist& D, std::vector<int>& P, double& dist, int max_passes) {
+    int m = (int)P.size();
+    if (m < 4) return 0;  // Pas assez de points pour 2-opt
+    const bool symmetric = D.symmetric();
+    RoutePrefix<Dist> prefix(D, P);
+    int moves = 0;
+    int passes = 0;
+    bool improved = true;
+    while (improved && (max_passes <= 0 || passes < max_passes)) {
+        improved = false;
+        ++passes;
+        for (int i = 0; i < m - 3; ++i) {
+            for (int k = i + 2; k < m - 1; ++k) {
+                int a = P[i], b = P[i + 1];
+                int c = P[k], d = P[k + 1];
+                double delta = D(a, c) + D(b, d) - D(a, b) - D(c, d);
+                if (!symmetric) delta += prefix.reversal_gap(i + 1, k);
+                // Le 2-opt ne modifie pas le temps : seule la distance doit diminuer
+                if (delta < -1e-9) {
+                    std::reverse(P.begin() + i + 1, P.begin() + k + 1);
+                    prefix.invalidate();
+                    dist += delta;
+                    improved = true;
+                    ++moves;
+                }
+            }
+        }
+    }
+    return moves;
+}
+
+template <typename Dist>
+int repair_route(const TapInstance& I, const Dist& D, std::vector<int>& P,
+                 std::vector<char>& used, double& time, double& dist) {
+    const double wT = 1.0 / I.epsilon_t;
+    const double wD = 1.0 / I.epsilon_d;
+    int removed = 0;
+    while (!P.empty() && !feasible(time, dist, I)) {
+        // Ne compter que la ressource en dépassement pour juger de l'économie
+        const bool over_t = time > I.epsilon_t;
+        const bool over_d = dist > I.epsilon_d;
+        size_t worst = 0;
+        double worstRatio = std::numeric_limits<double>::infinity();
+        for (size_t pos = 0; pos < P.size(); ++pos) {
+            int q = P[pos];
+            double saving = (over_t ? I.time[q] * wT : 0.0)
+                          + (over_d ? -delta_dist_rem(D, P, pos) * wD : 0.0);
+            if (saving <= 0) continue;
+            double ratio = I.interest[q] / saving;
+            if (ratio < worstRatio) {
+                worstRatio = ratio;
+                worst = pos;
+            }
+        }
+        if (worstRatio == std::numeric_limits<double>::infinity()) {
+            // Aucun retrait n'aide (distances non métriques) : retirer la fin
+            worst = P.size() - 1;
+        }
+        int q = P[worst];
+        dist += delta_dist_rem(D, P, worst);
+        time -= I.time[q];
+        used[q] = 0;
+        P.erase(P.begin() + worst);
+        ++removed;
+    }
+    if (P.empty()) {
+        time = 0.0;
+        dist = 0.0;
+    }
+    return removed;
+}
+
+template <typename Dist>
+int fill_route(const TapInstance& I, const Dist& D, std::vector<int>& P,
+               std::vector<char>& used, double& time, double& dist,
+               const std::vector<int>& candidates) {
+    int inserted = 0;
+    for (int q : candidates) {
+        if (used[q]) continue;
+        double dt = I.time[q];
+        if (time + dt > I.epsilon_t) continue;
+        size_t bestPos = P.size() + 1;
+        double bestDD = std::numeric_limits<double>::infinity();
+        for (size_t pos = 0; pos <= P.size(); ++pos) {
+            double dd = delta_dist_ins(D, P, q, pos);
+            if (dd < bestDD && dist + dd <= I.epsilon_d) {
+                bestDD = dd;
+                bestPos = pos;
+            }
+        }
+        if (bestPos <= P.size()) {
+            P.insert(P.begin() + bestPos, q);
+            used[q] = 1;
+            time += dt;
+            dist += bestDD;
+            ++inserted;
+        }
+    }
+    return inserted;
+}
+
+int route_two_opt(const TapInstance& I, std::vector<int>& P, double& dist, int max_passes) {
+    return route_two_opt(DenseDistances{I.dist}, P, dist, max_passes);
+}
+
+int repair_route(const TapInstance& I, std::vector<int>& P, std::vector<char>& used,
+                 double& time, double& dist) {
+    return repair_route(I, DenseDistances{I.dist}, P, used, time, dist);
+}
+
+int fill_route(const TapInstance& I, std::vector<int>& P, std::vector<char>& used,
+               double& time, double& dist, const std::vector<int>& candidates) {
+    return fill_route(I, DenseDistances{I.dist}, P, used, time, dist, candidates);
+}
+
+// Instanciations pour les trois représentations des distances
+#define TAP_ROUTE_OPS_INSTANTIATE(Dist)                                                    \
+    template int route_two_opt<Dist>(const Dist&, std::vector<int>&, double&, int);       \
+    template int repair_route<Dist>(const TapInstance&, const Dist&, std::vector<int>&,   \
+                                    std::vector<char>&, double&, double&);                \
+    template int fill_route<Dist>(const TapInstance&, const Dist&, std::vector<int>&,     \
+                                  std::vector<char>&, double&, double&,                   \
+                                  const std::vector<int>&);
+TAP_ROUTE_OPS_INSTANTIATE(DenseDistances)
+TAP_ROUTE_OPS_INSTANTIATE(CompactDistances)
+TAP_ROUTE_OPS_INSTANTIATE(OracleDistances)
+#undef TAP_ROUTE_OPS_INSTANTIATE
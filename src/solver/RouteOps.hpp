@@ -0,0 +1,226 @@
+#ifndef ROUTE_OPS_HPP
+#define ROUTE_OPS_HPP
+
+#include "loaders/DistanceProvider.hpp"
+#include "loaders/TapInstance.hpp"
+#include <vector>
+
+/**
+ * @file RouteOps.hpp
+ * @brief Opérations élémentaires sur une trajectoire, partagées par les solveurs
+ *
+ * Les fonctions inline servent dans les boucles chaudes (GreedySolver) ;
+ * les opérations plus lourdes (2-opt, réparation, remplissage) sont dans
+ * RouteOps.cpp et utilisées par les solveurs construits au-dessus.
+ *
+ * Chaque opération existe en deux formes : sur la matrice dense de
+ * l'instance (I.dist), et en modèle sur une vue de distances
+ * (DistanceProvider.hpp) pour les solveurs qui acceptent aussi les
+ * représentations Compact et Oracle. La forme dense appelle le modèle
+ * instancié avec DenseDistances.
+ */
+
+// =============================================================================
+//  Helper functions for feasibility checks and distance/insertion computations
+// =============================================================================
+
+/**
+ * @brief Vérifie si les contraintes temps et distance sont respectées.
+ *
+ * Permet de s'assurer à chaque étape que l'on ne dépasse pas
+ * les budgets epsilon définis pour l'instance TAP.
+ *
+ * @param t  Temps cumulé actuel
+ * @param d  Distance cumulée actuelle
+ * @param I  Instance TAP (contient epsilon_t et epsilon_d)
+ * @return true si t et d sont inférieurs ou égaux aux epsilons
+ */
+inline bool feasible(double t, double d, const TapInstance& I) {
+    return t <= I.epsilon_t && d <= I.epsilon_d;
+}
+
+/**
+ * @brief Calcule la variation de distance si l'on insère la requête q à la position pos de la trajectoire P.
+ *
+ * Utile pour évaluer le coût additionnel (en distance) de chaque insertion potentielle
+ * dans l'heuristique d'insertion gloutonne.
+ *
+ * @param D    Vue sur les distances (DenseDistances, CompactDistances, OracleDistances)
+ * @param P    Séquence actuelle de requêtes
+ * @param q    Indice de la requête candidate à insérer
+ * @param pos  Position d'insertion dans P (0 = début, P.size() = fin)
+ * @return Gain ou perte de distance (delta) dû à l'insertion
+ */
+template <typename Dist>
+inline double delta_dist_ins(
+    const Dist& D,
+    const std::vector<int>& P,
+    int q,
+    size_t pos
+) {
+    const size_t m = P.size();
+    if (m == 0) {
+        // Pas de déplacement préalable si la trajectoire est vide
+        return 0.0;
+    }
+    if (pos == 0) {
+        // Insertion en tête : coût = distance entre q et ancien premier
+        return D(q, P[0]);
+    } else if (pos == m) {
+        // Insertion en fin   : coût = distance entre ancien dernier et q
+        return D(P.back(), q);
+    } else {
+        // Insertion au milieu : coûte la somme des deux nouveaux arcs moins l'ancien arc
+        int a = P[pos - 1];
+        int b = P[pos];
+        return D(a, q) + D(q, b) - D(a, b);
+    }
+}
+
+/// delta_dist_ins sur la matrice dense de l'instance.
+inline double delta_dist_ins(const TapInstance& I, const std::vector<int>& P, int q, size_t pos) {
+    return delta_dist_ins(DenseDistances{I.dist}, P, q, pos);
+}
+
+/**
+ * @brief Calcule la variation de distance si l'on retire la requête en position pos.
+ *
+ * @param D    Vue sur les distances
+ * @param P    Séquence actuelle de requêtes (non vide)
+ * @param pos  Position de la requête à retirer
+ * @return Variation de distance (négative si le retrait raccourcit le parcours)
+ */
+template <typename Dist>
+inline double delta_dist_rem(
+    const Dist& D,
+    const std::vector<int>& P,
+    size_t pos
+) {
+    const size_t m = P.size();
+    if (m <= 1) return 0.0;
+    if (pos == 0)     return -D(P[0], P[1]);
+    if (pos == m - 1) return -D(P[m - 2], P[m - 1]);
+    int a = P[pos - 1], q = P[pos], b = P[pos + 1];
+    return D(a, b) - D(a, q) - D(q, b);
+}
+
+/// delta_dist_rem sur la matrice dense de l'instance.
+inline double delta_dist_rem(const TapInstance& I, const std::vector<int>& P, size_t pos) {
+    return delta_dist_rem(DenseDistances{I.dist}, P, pos);
+}
+
+/**
+ * @brief Sommes préfixes des arcs d'une trajectoire, à l'endroit et à l'envers.
+ *
+ * Sur une matrice asymétrique, inverser P[i..j] change aussi le coût des
+ * arcs intérieurs du segment, qu'il faudrait resommer en O(j - i) à chaque
+ * coup évalué. Avec fwd[k] = somme des D(P[t], P[t+1]) et rev[k] = somme
+ * des D(P[t+1], P[t]) pour t < k, ce surcoût s'obtient en O(1). Les
+ * tableaux ne sont recalculés (O(m)) qu'à la première évaluation qui suit
+ * un coup appliqué : invalidate() après chaque modification de P.
+ *
+ * Sur une matrice symétrique le surcoût est nul : les solveurs testent
+ * D.symmetric() et n'utilisent pas cette classe.
+ */
+template <typename Dist>
+class RoutePrefix {
+public:
+    /// P est lue par référence : elle doit survivre à l'objet.
+    RoutePrefix(const Dist& D, const std::vector<int>& P) : D_(D), P_(P) {}
+
+    /// À appeler après chaque modification appliquée à P.
+    void invalidate() { dirty_ = true; }
+
+    /// Coût des arcs intérieurs de P[i..j] parcourus à l'envers, moins à l'endroit.
+    double reversal_gap(int i, int j) {
+        if (dirty_) refresh();
+        return (rev_[j] - rev_[i]) - (fwd_[j] - fwd_[i]);
+    }
+
+private:
+    void refresh() {
+        const size_t m = P_.size();
+        fwd_.resize(m);
+        rev_.resize(m);
+        if (m > 0) fwd_[0] = rev_[0] = 0.0;
+        for (size_t t = 1; t < m; ++t) {
+            fwd_[t] = fwd_[t - 1] + D_(P_[t - 1], P_[t]);
+            rev_[t] = rev_[t - 1] + D_(P_[t], P_[t - 1]);
+        }
+        dirty_ = false;
+    }
+
+    Dist D_;
+    const std::vector<int>& P_;
+    std::vector<double> fwd_;
+    std::vector<double> rev_;
+    bool dirty_ = true;
+};
+
+/**
+ * @brief Amélioration 2-opt (première amélioration) d'une trajectoire.
+ *
+ * Même voisinage que le 2-opt d'EnhancedGreedy : inverse P[i+1..k] si les
+ * deux arcs frontières raccourcissent le parcours (plus, sur une matrice
+ * asymétrique, le surcoût des arcs intérieurs inversés, via RoutePrefix).
+ *
+ * @param D          Vue sur les distances
+ * @param P          Trajectoire à améliorer (modifiée en place)
+ * @param dist       Distance courante de P, mise à jour
+ * @param max_passes Nombre maximal de balayages (0 = jusqu'à convergence)
+ * @return Nombre de mouvements appliqués
+ */
+template <typename Dist>
+int route_two_opt(const Dist& D, std::vector<int>& P, double& dist, int max_passes = 0);
+
+/// route_two_opt sur la matrice dense de l'instance.
+int route_two_opt(const TapInstance& I, std::vector<int>& P, double& dist, int max_passes = 0);
+
+/**
+ * @brief Rétablit la faisabilité en retirant les requêtes les moins rentables.
+ *
+ * Tant que le temps ou la distance dépasse son epsilon, retire la requête
+ * de plus faible ratio intérêt / (économie de temps normalisée + économie
+ * de distance normalisée).
+ *
+ * @param I     Instance TAP (budgets, intérêts, temps)
+ * @param D     Vue sur les distances de I
+ * @param P     Trajectoire (modifiée en place)
+ * @param used  Marqueurs d'appartenance à P (taille n, mis à jour)
+ * @param time  Temps courant de P, mis à jour
+ * @param dist  Distance courante de P, mise à jour
+ * @return Nombre de requêtes retirées
+ */
+template <typename Dist>
+int repair_route(const TapInstance& I, const Dist& D, std::vector<int>& P,
+                 std::vector<char>& used, double& time, double& dist);
+
+/// repair_route sur la matrice dense de l'instance.
+int repair_route(const TapInstance& I, std::vector<int>& P, std::vector<char>& used,
+                 double& time, double& dist);
+
+/**
+ * @brief Insère au mieux (position de moindre distance) des requêtes candidates.
+ *
+ * Les candidats sont essayés dans l'ordre donné ; chacun est inséré à la
+ * position faisable de plus faible variation de distance.
+ *
+ * @param I          Instance TAP (budgets, intérêts, temps)
+ * @param D          Vue sur les distances de I
+ * @param P          Trajectoire (modifiée en place)
+ * @param used       Marqueurs d'appartenance à P (taille n, mis à jour)
+ * @param time       Temps courant de P, mis à jour
+ * @param dist       Distance courante de P, mise à jour
+ * @param candidates Requêtes à essayer (les requêtes déjà utilisées sont ignorées)
+ * @return Nombre de requêtes insérées
+ */
+template <typename Dist>
+int fill_route(const TapInstance& I, const Dist& D, std::vector<int>& P,
+               std::vector<char>& used, double& time, double& dist,
+               const std::vector<int>& candidates);
+
+/// fill_route sur la matrice dense de l'instance.
+int fill_route(const TapInstance& I, std::vector<int>& P, std::vector<char>& used,
+               double& time, double& dist, const std::vector<int>& candidates);
+
+#endif // ROUTE_OPS_HPP
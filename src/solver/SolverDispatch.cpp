@@ -0,0 +1,152 @@
+#include "solver/SolverDispatch.hpp"
+#include "solver/GreedySolver.hpp"
+#include "solver/Parallel.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+/**
+ * @file SolverDispatch.cpp
+ * @brief Sélection du solveur à partir des options de la ligne de commande
+ */
+
+namespace {
+
+/// Plus petite puissance de deux >= x, au moins lo.
+std::size_t pow2_at_least(std::size_t x, std::size_t lo) {
+    std::size_t p = lo;
+    while (p < x) p *= 2;
+    return p;
+}
+
+/// GreedyWorkspace : trois trajectoires, le pool, un cache de détours par politique.
+std::size_t greedy_bytes(std::size_t n) {
+    const std::size_t path = n * (sizeof(int) + sizeof(std::uint32_t));
+    const std::size_t pool = n * (3 * sizeof(int) + 1) + CandidatePool::kMaxPaths * sizeof(int);
+    const std::size_t detour = n * (sizeof(double) + sizeof(int) + sizeof(std::uint32_t));
+    return 3 * path + pool + CandidatePool::kMaxPaths * detour + 2 * n * sizeof(int);
+}
+
+/// TabuWorkspace : voisins, mémoire tabou, trajectoire et ensembles visités.
+std::size_t tabu_bytes(std::size_t n, const TabuConfig& cfg) {
+    const std::size_t k = std::min<std::size_t>((std::size_t)std::max(cfg.neighbours, 0),
+                                                n > 0 ? n - 1 : 0);
+    const std::size_t knn = n * (sizeof(std::vector<int>) + k * sizeof(int));
+    const std::size_t arrays = n * (sizeof(std::uint64_t) + 2 * sizeof(long) + 5 * sizeof(int) + 1);
+    // Au plus un ensemble visité par itération, table au plus à moitié pleine
+    const std::size_t iters = cfg.max_iters > 0 ? (std::size_t)cfg.max_iters : 1000000;
+    const std::size_t visited = pow2_at_least(2 * iters, 1u << 14) * sizeof(std::uint64_t);
+    return knn + arrays + visited;
+}
+
+/// MemeticWorkspace : trois populations, un espace de reproduction par thread.
+std::size_t memetic_bytes(std::size_t n, const MemeticConfig& cfg) {
+    const std::size_t P = (std::size_t)std::max(cfg.population, 2);
+    const std::size_t T = (std::size_t)resolve_thread_count(cfg.threads);
+    const std::size_t population = P * (n * sizeof(int) + sizeof(int) + 3 * sizeof(double)
+                                        + sizeof(std::uint64_t));
+    const std::size_t child = n * (2 * sizeof(int) + 1 + sizeof(double));
+    const std::size_t kept = pow2_at_least(4 * P, 64) * sizeof(std::uint64_t);
+    return 3 * population + T * child + n * (sizeof(int) + sizeof(std::uint64_t))
+         + 2 * P * (sizeof(int) + 1) + kept;
+}
+
+/// Sous-instance dense de m requêtes (matrice, intérêts, temps).
+std::size_t dense_bytes(std::size_t m) {
+    return m * (m * sizeof(double) + sizeof(std::vector<double>)) + 2 * m * sizeof(double)
+         + sizeof(TapInstance);
+}
+
+} // namespace
+
+SolverKind parse_solver_kind(const std::string& name) {
+    if (name == "greedy") return SolverKind::Greedy;
+    if (name == "decomp") return SolverKind::Decomposition;
+    if (name == "tabu")   return SolverKind::Tabu;
+    if (name == "memetic") return SolverKind::Memetic;
+    if (name == "portfolio") return SolverKind::Portfolio;
+    throw std::invalid_argument("Unknown solver: " + name);
+}
+
+const char* solver_kind_name(SolverKind kind) {
+    switch (kind) {
+    case SolverKind::Greedy:        return "greedy";
+    case SolverKind::Decomposition: return "decomp";
+    case SolverKind::Tabu:          return "tabu";
+    case SolverKind::Memetic:       return "memetic";
+    case SolverKind::Portfolio:     return "portfolio";
+    }
+    return "?";
+}
+
+std::vector<int> run_solver(const TapInstance& instance, const SolveOptions& opts,
+                            SolverStats* stats, IncumbentTrace* trace,
+                            Checkpointer* checkpoint) {
+    if (instance.backend != DistanceBackend::Dense && opts.kind != SolverKind::Decomposition) {
+        throw std::invalid_argument(std::string("Solver ") + solver_kind_name(opts.kind)
+                                    + " needs a dense distance matrix (use decomp)");
+    }
+    switch (opts.kind) {
+    case SolverKind::Greedy:
+        return greedy_solve(instance, stats, trace);
+    case SolverKind::Decomposition:
+        return decomposition_solve(instance, opts.decomposition, stats, trace);
+    case SolverKind::Tabu: {
+        TabuConfig cfg = opts.tabu;
+        if (opts.time_limit_ms > 0) cfg.time_limit_ms = opts.time_limit_ms;
+        return tabu_search(instance, cfg, {}, stats, trace, checkpoint);
+    }
+    case SolverKind::Memetic: {
+        MemeticConfig cfg = opts.memetic;
+        if (opts.time_limit_ms > 0) cfg.time_limit_ms = opts.time_limit_ms;
+        return memetic_solve(instance, cfg, {}, stats, trace, checkpoint);
+    }
+    case SolverKind::Portfolio: {
+        PortfolioConfig cfg = opts.portfolio;
+        cfg.tabu = opts.tabu;
+        cfg.memetic = opts.memetic;
+        if (opts.time_limit_ms > 0) cfg.time_limit_ms = opts.time_limit_ms;
+        return portfolio_solve(instance, cfg, stats, trace);
+    }
+    }
+    return {};
+}
+
+std::size_t estimate_solver_bytes(int n, const SolveOptions& opts) {
+    const std::size_t N = (std::size_t)std::max(n, 0);
+    switch (opts.kind) {
+    case SolverKind::Greedy:
+        return greedy_bytes(N);
+    case SolverKind::Tabu:
+        return greedy_bytes(N) + tabu_bytes(N, opts.tabu);
+    case SolverKind::Memetic:
+        return greedy_bytes(N) + memetic_bytes(N, opts.memetic);
+    case SolverKind::Portfolio: {
+        // Glouton sur le thread principal, puis un espace par moteur (sans glouton)
+        MemeticConfig mc = opts.memetic;
+        mc.threads = 1;
+        const PortfolioConfig& pc = opts.portfolio;
+        return greedy_bytes(N) + (std::size_t)std::max(pc.tabu_engines, 0) * tabu_bytes(N, opts.tabu)
+             + (std::size_t)std::max(pc.memetic_engines, 0) * memetic_bytes(N, mc);
+    }
+    case SolverKind::Decomposition: {
+        const DecompositionConfig& dc = opts.decomposition;
+        std::size_t k = dc.clusters > 0
+                      ? (std::size_t)dc.clusters
+                      : (N + (std::size_t)std::max(1, dc.cluster_size) / 2)
+                            / (std::size_t)std::max(1, dc.cluster_size);
+        k = std::min(k, N);
+        // Petite instance : greedy_solve sur la matrice dense (matérialisée au pire)
+        if (k < 2) return dense_bytes(N) + greedy_bytes(N);
+        // Une sous-instance à la fois par thread ; la plus grande dépasse la moyenne
+        const std::size_t m = std::min(N, 2 * ((N + k - 1) / k));
+        const std::size_t T = std::min(k, (std::size_t)resolve_thread_count(dc.threads));
+        return T * (dense_bytes(m) + greedy_bytes(m)) + N * 8 * sizeof(int);
+    }
+    }
+    return 0;
+}
+
+bool solver_supports_checkpoint(SolverKind kind) {
+    return kind == SolverKind::Tabu || kind == SolverKind::Memetic;
+}
@@ -0,0 +1,85 @@
+#ifndef SOLVER_DISPATCH_HPP
+#define SOLVER_DISPATCH_HPP
+
+#include "loaders/TapInstance.hpp"
+#include "solver/Checkpoint.hpp"
+#include "solver/DecompositionSolver.hpp"
+#include "solver/IncumbentTrace.hpp"
+#include "solver/MemeticSolver.hpp"
+#include "solver/PortfolioSolver.hpp"
+#include "solver/SolverStats.hpp"
+#include "solver/TabuSearch.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Solveurs disponibles depuis la ligne de commande.
+ */
+enum class SolverKind {
+    Greedy,          ///< greedy_solve (FastGreedy + EnhancedGreedy)
+    Decomposition,   ///< decomposition_solve (très grandes instances)
+    Tabu,            ///< tabu_search à partir de greedy_solve
+    Memetic,         ///< memetic_solve (population + recherche locale)
+    Portfolio        ///< portfolio_solve (course entre tabu et memetic)
+};
+
+/**
+ * @brief Choix du solveur et de ses paramètres pour une résolution.
+ */
+struct SolveOptions {
+    SolverKind kind = SolverKind::Greedy;
+    DecompositionConfig decomposition;   ///< Utilisé si kind == Decomposition
+    TabuConfig tabu;                     ///< Utilisé si kind == Tabu ou Portfolio
+    MemeticConfig memetic;               ///< Utilisé si kind == Memetic ou Portfolio
+    PortfolioConfig portfolio;           ///< Utilisé si kind == Portfolio (moteurs : tabu et memetic ci-dessus)
+    double time_limit_ms = 0.0;          ///< Limite de temps des solveurs itératifs (0 = défaut du solveur)
+};
+
+/**
+ * @brief Analyse un nom de solveur ("greedy", "decomp", "tabu", "memetic", "portfolio").
+ *
+ * @throws std::invalid_argument si le nom n'est pas reconnu
+ */
+SolverKind parse_solver_kind(const std::string& name);
+
+/**
+ * @brief Nom affichable d'un solveur (inverse de parse_solver_kind).
+ */
+const char* solver_kind_name(SolverKind kind);
+
+/**
+ * @brief Résout une instance avec le solveur choisi.
+ *
+ * @param instance Instance TAP
+ * @param opts     Solveur et paramètres
+ * @param stats    Statistiques (optionnel)
+ * @param trace    Journal des incumbents (optionnel)
+ * @param checkpoint Sauvegardes et reprise (optionnel, solveurs itératifs seulement)
+ * @return Séquence d'indices de requêtes
+ * @throws std::invalid_argument si le solveur exige une matrice dense
+ *         et que l'instance est Compact ou Oracle (seul decomp les accepte)
+ */
+std::vector<int> run_solver(const TapInstance& instance, const SolveOptions& opts,
+                            SolverStats* stats = nullptr, IncumbentTrace* trace = nullptr,
+                            Checkpointer* checkpoint = nullptr);
+
+/**
+ * @brief Mémoire de travail du solveur sur une instance de n requêtes (octets).
+ *
+ * Estimation avant chargement de ce que SolverStats::workspace_bytes
+ * mesurera : tampons gloutons, voisins et ensembles visités de tabu,
+ * populations de memetic, sous-instances denses de decomp (une par
+ * thread). Ne compte pas l'instance elle-même (estimate_instance_bytes).
+ *
+ * @param n    Nombre de requêtes
+ * @param opts Solveur et paramètres
+ */
+std::size_t estimate_solver_bytes(int n, const SolveOptions& opts);
+
+/**
+ * @brief Vrai si le solveur sait sauvegarder et reprendre sa recherche.
+ */
+bool solver_supports_checkpoint(SolverKind kind);
+
+#endif // SOLVER_DISPATCH_HPP
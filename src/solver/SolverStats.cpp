@@ -0,0 +1,109 @@
+#include "solver/SolverStats.hpp"
+#include <iomanip>
+#include <string>
+
+/**
+ * @file SolverStats.cpp
+ * @brief Noms des phases, cumul et affichage des statistiques de résolution
+ */
+
+const char* solver_phase_name(SolverPhase phase) {
+    switch (phase) {
+    case SolverPhase::FastSeed:          return "Fast/seed";
+    case SolverPhase::EnhancedSeed:      return "Enhanced/seed";
+    case SolverPhase::GreedyInsertion:   return "Greedy/insertion";
+    case SolverPhase::FastTwoOpt:        return "Fast/2-opt";
+    case SolverPhase::FastTail:          return "Fast/tail";
+    case SolverPhase::EnhancedRest:      return "Enhanced/rest";
+    case SolverPhase::EnhancedTwoOpt:    return "Enhanced/2-opt";
+    case SolverPhase::EnhancedBaseline:  return "Enhanced/baseline";
+    case SolverPhase::DecompCluster:     return "Decomp/cluster";
+    case SolverPhase::DecompSolve:       return "Decomp/solve";
+    case SolverPhase::DecompStitch:      return "Decomp/stitch";
+    case SolverPhase::DecompRepair:      return "Decomp/repair";
+    case SolverPhase::TabuSearch:        return "Tabu/search";
+    case SolverPhase::MemeticInit:       return "Memetic/init";
+    case SolverPhase::MemeticEvolve:     return "Memetic/evolve";
+    case SolverPhase::Count:             break;
+    }
+    return "?";
+}
+
+void SolverStats::merge(const SolverStats& o) {
+    insertion_evaluations  += o.insertion_evaluations;
+    feasibility_rejections += o.feasibility_rejections;
+    candidates_scanned     += o.candidates_scanned;
+    candidates_retired     += o.candidates_retired;
+    evaluations_avoided    += o.evaluations_avoided;
+    two_opt_passes         += o.two_opt_passes;
+    two_opt_moves          += o.two_opt_moves;
+    baseline_fallback_won   = baseline_fallback_won || o.baseline_fallback_won;
+    tabu_iterations        += o.tabu_iterations;
+    tabu_moves_evaluated   += o.tabu_moves_evaluated;
+    tabu_aspirations       += o.tabu_aspirations;
+    tabu_cycle_rejections  += o.tabu_cycle_rejections;
+    memetic_generations    += o.memetic_generations;
+    memetic_children       += o.memetic_children;
+    portfolio_slices       += o.portfolio_slices;
+    portfolio_stalled      += o.portfolio_stalled;
+    portfolio_proven_optimal = portfolio_proven_optimal || o.portfolio_proven_optimal;
+    workspace_bytes        += o.workspace_bytes;
+    for (int p = 0; p < (int)SolverPhase::Count; ++p) {
+        phase_ns[p] += o.phase_ns[p];
+        phase_perf[p].add(o.phase_perf[p]);
+    }
+}
+
+PerfSample SolverStats::total_perf() const {
+    PerfSample total;
+    for (const PerfSample& s : phase_perf) total.add(s);
+    return total;
+}
+
+void SolverStats::print(std::ostream& os, const char* indent) const {
+#if TAP_SOLVER_STATS
+    os << indent << "Évaluations insertion : " << insertion_evaluations << "\n";
+    os << indent << "Rejets faisabilité    : " << feasibility_rejections << "\n";
+    os << indent << "Candidats examinés    : " << candidates_scanned << "\n";
+    os << indent << "Candidats retirés     : " << candidates_retired
+       << " (" << evaluations_avoided << " évaluations évitées)\n";
+    os << indent << "Passes / moves 2-opt  : " << two_opt_passes << " / " << two_opt_moves << "\n";
+    os << indent << "Fallback baseline     : " << std::boolalpha << baseline_fallback_won << "\n";
+    if (tabu_iterations > 0) {
+        os << indent << "Itérations tabou      : " << tabu_iterations
+           << " (" << tabu_moves_evaluated << " coups évalués, "
+           << tabu_aspirations << " aspirations, "
+           << tabu_cycle_rejections << " cycles évités)\n";
+    }
+    if (memetic_generations > 0) {
+        os << indent << "Générations mémétique : " << memetic_generations
+           << " (" << memetic_children << " enfants)\n";
+    }
+    if (portfolio_slices > 0 || portfolio_proven_optimal) {
+        os << indent << "Tranches portfolio    : " << portfolio_slices
+           << " (" << portfolio_stalled << " moteurs arrêtés sans progrès, optimum prouvé : "
+           << std::boolalpha << portfolio_proven_optimal << ")\n";
+    }
+    for (int p = 0; p < (int)SolverPhase::Count; ++p) {
+        if (phase_ns[p] == 0) continue;
+        os << indent << "  " << std::left << std::setw(20) << solver_phase_name((SolverPhase)p)
+           << std::right << std::setw(12) << phase_ns[p] << " ns";
+        double ipc = phase_perf[p].ipc();
+        if (ipc >= 0) {
+            std::ios::fmtflags flags = os.flags();
+            std::streamsize prec = os.precision(2);
+            os << "  IPC=" << std::fixed << ipc;
+            os.flags(flags);
+            os.precision(prec);
+        }
+        os << "\n";
+    }
+    if (perf_counters_active()) {
+        std::string sub = std::string(indent) + "  ";
+        os << indent << "Compteurs matériels  :\n";
+        print_perf_sample(os, total_perf(), insertion_evaluations, sub.c_str());
+    }
+#else
+    os << indent << "Statistiques désactivées (TAP_SOLVER_STATS=0)\n";
+#endif
+}
@@ -0,0 +1,144 @@
+#ifndef SOLVER_STATS_HPP
+#define SOLVER_STATS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include "solver/PerfCounters.hpp"
+
+/**
+ * @brief Active (1) ou désactive (0) l'instrumentation des solveurs.
+ *
+ * Désactivée, toutes les macros TAP_STAT / TAP_PHASE_TIMER deviennent
+ * des instructions vides et la boucle chaude n'est pas modifiée.
+ * Se règle à la compilation : make STATS=0
+ */
+#ifndef TAP_SOLVER_STATS
+#define TAP_SOLVER_STATS 1
+#endif
+
+/**
+ * @brief Phases chronométrées des solveurs.
+ */
+enum class SolverPhase : int {
+    FastSeed = 0,        ///< FastGreedy : choix de la requête de départ
+    EnhancedSeed,        ///< EnhancedGreedy : choix de la requête de départ
+    GreedyInsertion,     ///< FastGreedy + EnhancedGreedy : insertion gloutonne fusionnée
+    FastTwoOpt,          ///< FastGreedy : amélioration 2-opt
+    FastTail,            ///< FastGreedy : ajout en fin de parcours
+    EnhancedRest,        ///< EnhancedGreedy : insertion des requêtes restantes
+    EnhancedTwoOpt,      ///< EnhancedGreedy : amélioration 2-opt
+    EnhancedBaseline,    ///< EnhancedGreedy : construction du fallback baseline
+    DecompCluster,       ///< Décomposition : k-medoids
+    DecompSolve,         ///< Décomposition : résolution des sous-instances
+    DecompStitch,        ///< Décomposition : ordonnancement et raccord des sous-routes
+    DecompRepair,        ///< Décomposition : réparation et amélioration globales
+    TabuSearch,          ///< Recherche tabou (hors construction initiale)
+    MemeticInit,         ///< Mémétique : population initiale
+    MemeticEvolve,       ///< Mémétique : générations
+    Count
+};
+
+/**
+ * @brief Nom affichable d'une phase.
+ */
+const char* solver_phase_name(SolverPhase phase);
+
+/**
+ * @brief Compteurs et chronomètres d'une résolution.
+ *
+ * Rempli par greedy_solve() lorsqu'un pointeur non nul lui est passé.
+ */
+struct SolverStats {
+    std::uint64_t insertion_evaluations = 0;   ///< Couples (requête, position) évalués
+    std::uint64_t feasibility_rejections = 0;  ///< Évaluations rejetées par les epsilons
+    std::uint64_t candidates_scanned = 0;      ///< Requêtes candidates examinées
+    std::uint64_t candidates_retired = 0;      ///< Candidates retirées définitivement (budget de temps épuisé)
+    std::uint64_t evaluations_avoided = 0;     ///< Évaluations évitées (candidates retirées, détours en cache)
+    std::uint64_t two_opt_passes = 0;          ///< Balayages 2-opt effectués
+    std::uint64_t two_opt_moves = 0;           ///< Mouvements 2-opt améliorants appliqués
+    bool baseline_fallback_won = false;        ///< La baseline a battu EnhancedGreedy
+    std::uint64_t tabu_iterations = 0;         ///< Itérations de la recherche tabou
+    std::uint64_t tabu_moves_evaluated = 0;    ///< Coups évalués par la recherche tabou
+    std::uint64_t tabu_aspirations = 0;        ///< Coups tabous acceptés par aspiration
+    std::uint64_t tabu_cycle_rejections = 0;   ///< Coups refusés car ramenant à un ensemble déjà visité
+    std::uint64_t memetic_generations = 0;     ///< Générations de l'algorithme mémétique
+    std::uint64_t memetic_children = 0;        ///< Enfants produits et évalués
+    std::uint64_t portfolio_slices = 0;        ///< Tranches de temps accordées aux moteurs d'une course
+    std::uint64_t portfolio_stalled = 0;       ///< Moteurs annulés faute de progrès
+    bool portfolio_proven_optimal = false;     ///< L'incumbent a atteint la borne supérieure
+    std::size_t workspace_bytes = 0;           ///< Mémoire de travail des solveurs (octets, somme des threads)
+    std::uint64_t phase_ns[(int)SolverPhase::Count] = {};  ///< Durée de chaque phase (ns)
+    PerfSample phase_perf[(int)SolverPhase::Count];        ///< Compteurs matériels par phase
+
+    /**
+     * @brief Somme des compteurs matériels de toutes les phases.
+     */
+    PerfSample total_perf() const;
+
+    /**
+     * @brief Cumule les compteurs d'une autre résolution.
+     */
+    void merge(const SolverStats& other);
+
+    /**
+     * @brief Affiche les compteurs et les phases non nulles, une par ligne.
+     *
+     * @param os     Flux de sortie
+     * @param indent Préfixe de chaque ligne (alignement avec main.cpp)
+     */
+    void print(std::ostream& os, const char* indent = "  ") const;
+};
+
+/**
+ * @brief Chronomètre RAII qui ajoute la durée de sa portée à une phase.
+ *
+ * Si perf_counters_enable() a été appelé sur ce thread, les compteurs
+ * matériels sont aussi lus en entrée et en sortie de portée.
+ */
+class ScopedPhaseTimer {
+public:
+    ScopedPhaseTimer(SolverStats& stats, SolverPhase phase)
+        : stats_(stats), phase_(phase), perf_(perf_counters_active()) {
+        if (perf_) perf_counters_read(perf_begin_);
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    ~ScopedPhaseTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        stats_.phase_ns[(int)phase_] +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        if (perf_) {
+            PerfSample end;
+            perf_counters_read(end);
+            stats_.phase_perf[(int)phase_].accumulate(perf_begin_, end);
+        }
+    }
+
+    ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+    ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+private:
+    SolverStats& stats_;
+    SolverPhase phase_;
+    bool perf_;
+    PerfSample perf_begin_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#define TAP_STAT_CONCAT_(a, b) a##b
+#define TAP_STAT_CONCAT(a, b) TAP_STAT_CONCAT_(a, b)
+
+#if TAP_SOLVER_STATS
+/// Exécute l'instruction de comptage uniquement si l'instrumentation est active.
+#define TAP_STAT(stmt) do { stmt; } while (0)
+/// Chronomètre la fin de la portée courante dans la phase donnée.
+#define TAP_PHASE_TIMER(stats, phase) \
+    ScopedPhaseTimer TAP_STAT_CONCAT(tap_phase_timer_, __LINE__)((stats), (phase))
+#else
+#define TAP_STAT(stmt) do { } while (0)
+#define TAP_PHASE_TIMER(stats, phase) do { (void)(stats); } while (0)
+#endif
+
+#endif // SOLVER_STATS_HPP
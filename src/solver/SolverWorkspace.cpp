@@ -0,0 +1,51 @@
+#include "solver/SolverWorkspace.hpp"
+
+/**
+ * @file SolverWorkspace.cpp
+ * @brief Espace de travail par thread et mémoire réservée
+ */
+
+SolverWorkspace& SolverWorkspace::local() {
+    thread_local SolverWorkspace workspace;
+    return workspace;
+}
+
+namespace {
+
+std::size_t path_bytes(const WorkPath& P) {
+    return P.nodes.capacity() * sizeof(int) + P.used.capacity_bytes();
+}
+
+} // namespace
+
+std::size_t SolverWorkspace::capacity_bytes() const {
+    const GreedyWorkspace& g = greedy;
+    std::size_t bytes = path_bytes(g.fast) + path_bytes(g.enhanced) + path_bytes(g.baseline)
+                      + g.pool.capacity_bytes()
+                      + (g.order.capacity() + g.result.capacity()) * sizeof(int);
+    for (const DetourCache& c : g.detour) {
+        bytes += c.dd.capacity() * sizeof(double) + c.pos.capacity() * sizeof(int)
+               + c.known.capacity_bytes();
+    }
+
+    const TabuWorkspace& t = tabu;
+    bytes += t.zobrist.capacity() * sizeof(std::uint64_t)
+           + t.knn.capacity() * sizeof(std::vector<int>)
+           + (t.others.capacity() + t.path.capacity() + t.pos.capacity() + t.free.capacity()
+              + t.free_idx.capacity()) * sizeof(int)
+           + (t.add_until.capacity() + t.drop_until.capacity()) * sizeof(long)
+           + t.visited.capacity_bytes() + t.used.capacity();
+    for (const std::vector<int>& row : t.knn) bytes += row.capacity() * sizeof(int);
+
+    const MemeticWorkspace& m = memetic;
+    bytes += m.parents.capacity_bytes() + m.children.capacity_bytes()
+           + m.survivors.capacity_bytes()
+           + (m.by_ratio.capacity() + m.ranking.capacity()) * sizeof(int)
+           + m.zobrist.capacity() * sizeof(std::uint64_t) + m.taken.capacity()
+           + m.kept.capacity_bytes();
+    for (const MemeticChild& c : m.threads) {
+        bytes += (c.route.capacity() + c.order.capacity()) * sizeof(int) + c.used.capacity()
+               + c.keys.capacity() * sizeof(double);
+    }
+    return bytes;
+}
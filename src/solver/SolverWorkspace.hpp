@@ -0,0 +1,269 @@
+#ifndef SOLVER_WORKSPACE_HPP
+#define SOLVER_WORKSPACE_HPP
+
+#include "solver/CandidatePool.hpp"
+#include "solver/Population.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Ensemble de requêtes marquées, vidé en O(1).
+ *
+ * Une requête est marquée si son tampon porte l'époque courante ; clear()
+ * passe à l'époque suivante au lieu de remettre n cases à zéro.
+ */
+class MarkSet {
+public:
+    /// Vide l'ensemble et l'étend à n requêtes (n'alloue que si n grandit).
+    void clear(int n) {
+        if ((int)stamp_.size() < n) stamp_.resize(n, 0);
+        if (++epoch_ == 0) {
+            // Débordement de l'époque (tous les 2^32 appels) : remise à zéro réelle
+            std::fill(stamp_.begin(), stamp_.end(), 0u);
+            epoch_ = 1;
+        }
+    }
+
+    bool test(int q) const { return stamp_[q] == epoch_; }
+    void set(int q) { stamp_[q] = epoch_; }
+    void unset(int q) { stamp_[q] = 0; }
+
+    /// Octets réservés.
+    std::size_t capacity_bytes() const { return stamp_.capacity() * sizeof(std::uint32_t); }
+
+private:
+    std::vector<std::uint32_t> stamp_;
+    std::uint32_t epoch_ = 0;
+};
+
+/**
+ * @brief Trajectoire en construction des heuristiques gloutonnes.
+ *
+ * Stocke la trajectoire, les marqueurs d'appartenance, et les métriques cumulées.
+ */
+struct WorkPath {
+    std::vector<int> nodes;         ///< Séquence de requêtes
+    MarkSet used;                   ///< Requêtes déjà insérées
+    double time = 0.0;              ///< Temps cumulé
+    double dist = 0.0;              ///< Distance cumulée
+    double reward = 0.0;            ///< Intérêt total accumulé
+
+    /// Trajectoire vide pour une instance de n requêtes.
+    void clear(int n) {
+        if ((int)nodes.capacity() < n) nodes.reserve(n);
+        nodes.clear();
+        used.clear(n);
+        time = dist = reward = 0.0;
+    }
+
+    /// Insère q en position pos (détour dd déjà calculé).
+    void insert(int q, std::size_t pos, double dt, double dd, double interest) {
+        nodes.insert(nodes.begin() + pos, q);
+        used.set(q);
+        time   += dt;
+        dist   += dd;
+        reward += interest;
+    }
+};
+
+/**
+ * @brief Plus petit détour d'insertion de chaque candidate dans une trajectoire.
+ *
+ * Après l'insertion d'une requête en position p, seules les positions p
+ * et p + 1 sont nouvelles ; les autres gardent leur détour (décalées d'un
+ * cran au-delà de p). Une candidate ne réévalue donc que deux positions
+ * par tour, sauf si son meilleur arc est celui qui vient d'être coupé.
+ * Tant que le coût d'une politique reste positif, son score décroît avec
+ * le détour : la position de plus petit détour est la meilleure, et si
+ * elle dépasse epsilon_d toutes les autres aussi (sinon, voir scan_cached).
+ */
+struct DetourCache {
+    std::vector<double> dd;   ///< Plus petit détour de q (première position en cas d'égalité)
+    std::vector<int> pos;     ///< Position correspondante (valide si known.test(q))
+    MarkSet known;            ///< Candidates dont le détour est calculé
+    int split = -1;           ///< Position de la dernière insertion (-1 : aucune)
+
+    void clear(int n) {
+        if ((int)dd.size() < n) {
+            dd.resize(n);
+            pos.resize(n);
+        }
+        known.clear(n);
+        split = -1;
+    }
+};
+
+/**
+ * @brief Tampons de greedy_solve.
+ */
+struct GreedyWorkspace {
+    WorkPath fast;                  ///< Trajectoire de FastGreedy
+    WorkPath enhanced;              ///< Trajectoire d'EnhancedGreedy
+    WorkPath baseline;              ///< Fallback baseline d'EnhancedGreedy
+    CandidatePool pool;             ///< Candidates de l'insertion fusionnée
+    std::array<DetourCache, CandidatePool::kMaxPaths> detour;   ///< Un cache par politique
+    std::vector<int> order;         ///< Requêtes triées (baseline, requêtes restantes)
+    std::vector<int> result;        ///< Solution retenue
+};
+
+/**
+ * @brief Ensemble de hachés 64 bits (adressage ouvert, sondage linéaire).
+ *
+ * Plus compact et plus rapide qu'un std::unordered_set pour des clés
+ * déjà uniformément réparties. clear() garde la table : O(taille de la
+ * table), sans allocation.
+ */
+class HashSet {
+public:
+    /// @param slots Taille initiale de la table (puissance de deux), doublée au besoin
+    explicit HashSet(std::size_t slots = 1u << 14) : table_(slots, 0) {}
+
+    bool contains(std::uint64_t h) const {
+        h = key(h);
+        for (std::size_t i = h & mask(); ; i = (i + 1) & mask()) {
+            if (table_[i] == h) return true;
+            if (table_[i] == 0) return false;
+        }
+    }
+
+    /// Ajoute h ; false s'il était déjà présent.
+    bool insert(std::uint64_t h) {
+        if ((size_ + 1) * 2 > table_.size()) grow();
+        if (!place(key(h))) return false;
+        ++size_;
+        return true;
+    }
+
+    void clear() {
+        std::fill(table_.begin(), table_.end(), 0);
+        size_ = 0;
+    }
+
+    /// Octets réservés.
+    std::size_t capacity_bytes() const { return table_.capacity() * sizeof(std::uint64_t); }
+
+private:
+    static std::uint64_t key(std::uint64_t h) { return h ? h : 1; }  // 0 = case vide
+    std::size_t mask() const { return table_.size() - 1; }
+
+    bool place(std::uint64_t h) {
+        for (std::size_t i = h & mask(); ; i = (i + 1) & mask()) {
+            if (table_[i] == h) return false;
+            if (table_[i] == 0) { table_[i] = h; return true; }
+        }
+    }
+
+    void grow() {
+        std::vector<std::uint64_t> old(table_.size() * 2, 0);
+        old.swap(table_);
+        for (std::uint64_t h : old) if (h) place(h);
+    }
+
+    std::vector<std::uint64_t> table_;
+    std::size_t size_ = 0;
+};
+
+/**
+ * @brief Tampons de tabu_search.
+ */
+struct TabuWorkspace {
+    std::vector<std::uint64_t> zobrist;   ///< Clé de Zobrist de chaque requête
+    std::vector<std::vector<int>> knn;    ///< Plus proches voisins de chaque requête
+    std::vector<int> others;              ///< Tri des voisins d'une requête
+    std::vector<long> add_until;          ///< Itération de fin d'interdiction d'ajout
+    std::vector<long> drop_until;         ///< Itération de fin d'interdiction de retrait
+    HashSet visited;                      ///< Ensembles de requêtes déjà visités
+    std::vector<int> path;                ///< Trajectoire courante
+    std::vector<int> pos;                 ///< Position dans path, -1 si libre
+    std::vector<int> free;                ///< Requêtes hors trajectoire
+    std::vector<int> free_idx;            ///< Position dans free, -1 si dans path
+    std::vector<char> used;               ///< Réparation de la solution de départ
+};
+
+/**
+ * @brief Tampons d'un thread de memetic_solve, réutilisés d'un enfant à l'autre.
+ *
+ * Invariant : used est entièrement à 0 entre deux enfants.
+ */
+struct MemeticChild {
+    std::vector<int> route;
+    std::vector<char> used;
+    std::vector<double> keys;
+    std::vector<int> order;
+
+    /// Prépare les tampons pour n requêtes (n'alloue que si n grandit).
+    void clear(int n) {
+        if ((int)route.capacity() < n) route.reserve(n);
+        route.clear();
+        used.assign(n, 0);
+        keys.resize(n);
+        order.resize(n);
+    }
+};
+
+/**
+ * @brief Tampons de memetic_solve.
+ */
+struct MemeticWorkspace {
+    Population parents;                   ///< Génération courante
+    Population children;                  ///< Enfants de la génération
+    Population survivors;                 ///< Génération suivante en construction
+    std::vector<MemeticChild> threads;    ///< Un espace par thread de reproduction
+    std::vector<int> by_ratio;            ///< Requêtes par ratio intérêt / temps décroissant
+    std::vector<std::uint64_t> zobrist;   ///< Clé de Zobrist de chaque requête
+    std::vector<int> ranking;             ///< Classement des parents et enfants
+    std::vector<char> taken;              ///< Individus déjà retenus
+    HashSet kept{64};                     ///< Hachés des survivants
+};
+
+/**
+ * @brief Mémoire de travail des solveurs, réutilisée d'une résolution à l'autre.
+ *
+ * Les tampons grandissent jusqu'à la plus grande instance rencontrée et ne
+ * sont jamais rendus : en régime établi (instances de taille au plus égale),
+ * une résolution gloutonne n'alloue plus rien, une recherche tabou ou
+ * mémétique n'alloue plus que ses solutions renvoyées et sauvegardées. La
+ * remise à zéro entre deux résolutions gloutonnes est en O(1) : les
+ * marqueurs sont datés (MarkSet) et les autres tableaux sont entièrement
+ * réécrits par le solveur avant lecture. tabu_search et memetic_solve
+ * réinitialisent leurs tableaux en O(n) (O(population * n) pour les
+ * populations), négligeable devant la recherche.
+ *
+ * Un espace de travail ne sert qu'à un thread à la fois. local() en donne
+ * un par thread : c'est celui qu'utilisent les appels sans espace de
+ * travail explicite (workers du serveur, sous-instances de decomp).
+ */
+class SolverWorkspace {
+public:
+    /// Espace de travail propre au thread appelant.
+    static SolverWorkspace& local();
+
+    /// Prépare une résolution sur n requêtes ; renvoie l'espace lui-même.
+    SolverWorkspace& prepare(int n) {
+        ++runs_;
+        largest_ = std::max(largest_, n);
+        return *this;
+    }
+
+    /// Nombre de résolutions servies.
+    std::uint64_t runs() const { return runs_; }
+
+    /// Plus grande instance servie.
+    int largest() const { return largest_; }
+
+    /// Octets réservés par les tampons.
+    std::size_t capacity_bytes() const;
+
+    GreedyWorkspace greedy;         ///< Tampons de greedy_solve
+    TabuWorkspace tabu;             ///< Tampons de tabu_search
+    MemeticWorkspace memetic;       ///< Tampons de memetic_solve
+
+private:
+    std::uint64_t runs_ = 0;
+    int largest_ = 0;
+};
+
+#endif // SOLVER_WORKSPACE_HPP
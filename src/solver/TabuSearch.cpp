@@ -0,0 +1,510 @@
+#include "solver/TabuSearch.hpp"
+#include "solver/GreedySolver.hpp"
+#include "solver/FastRng.hpp"
+#include "solver/RouteOps.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+/**
+ * @file TabuSearch.cpp
+ * @brief Recherche tabou : voisinages restreints, mémoire par attribut et hachage de Zobrist
+ */
+
+namespace {
+
+/**
+ * @brief Liste de candidats : les k plus proches voisins de chaque requête.
+ *
+ * Remplit ws.knn (lignes réutilisées d'une résolution à l'autre).
+ */
+void nearest_neighbours(const TapInstance& I, int k, TabuWorkspace& ws) {
+    const int n = I.size;
+    k = std::max(0, std::min(k, n - 1));
+    if ((int)ws.knn.size() < n) ws.knn.resize(n);
+    std::vector<int>& others = ws.others;
+    for (int q = 0; q < n; ++q) {
+        others.clear();
+        for (int v = 0; v < n; ++v) if (v != q) others.push_back(v);
+        auto closer = [&](int a, int b) {
+            double da = I.dist[q][a] + I.dist[a][q];
+            double db = I.dist[q][b] + I.dist[b][q];
+            return da < db || (da == db && a < b);
+        };
+        std::partial_sort(others.begin(), others.begin() + k, others.end(), closer);
+        ws.knn[q].assign(others.begin(), others.begin() + k);
+    }
+}
+
+enum class MoveKind { Add, Swap, Drop, Relocate, TwoOpt };
+
+/**
+ * @brief Coup candidat et ses variations.
+ */
+struct Move {
+    MoveKind kind = MoveKind::Add;
+    int q = -1;        ///< Requête entrante (Add, Swap), ancre (Relocate)
+    int r = -1;        ///< Requête sortante (Swap, Drop)
+    int i = 0;         ///< Position (Add, Swap, Drop) ou début du segment (TwoOpt)
+    int j = 0;         ///< Fin du segment inversé (TwoOpt), côté de l'ancre (Relocate, 0 = après)
+    double dV = 0.0;   ///< Variation d'intérêt
+    double dT = 0.0;   ///< Variation de temps
+    double dD = 0.0;   ///< Variation de distance
+    double score = -std::numeric_limits<double>::infinity();
+};
+
+/**
+ * @brief État courant de la recherche : trajectoire, positions et requêtes libres.
+ *
+ * Les tableaux sont ceux de l'espace de travail (TabuWorkspace).
+ */
+class Route {
+public:
+    Route(const TapInstance& I, TabuWorkspace& ws)
+        : I_(I), P_(ws.path), pos_(ws.pos), free_(ws.free), free_idx_(ws.free_idx) {
+        P_.clear();
+        free_.clear();
+        pos_.assign(I.size, -1);
+        free_idx_.assign(I.size, -1);
+        for (int q = 0; q < I.size; ++q) push_free(q);
+    }
+
+    void assign(const std::vector<int>& P, const std::vector<std::uint64_t>& zobrist) {
+        for (int q : P_) push_free(q);
+        for (int q : P_) pos_[q] = -1;
+        P_ = P;
+        hash = 0;
+        for (int k = 0; k < (int)P_.size(); ++k) {
+            pos_[P_[k]] = k;
+            pop_free(P_[k]);
+            hash ^= zobrist[P_[k]];
+        }
+        T = I_.solution_time(P_);
+        D = I_.solution_distance(P_);
+        V = I_.solution_interest(P_);
+    }
+
+    void insert_at(int q, int p) {
+        P_.insert(P_.begin() + p, q);
+        pop_free(q);
+        reindex(p);
+    }
+
+    void erase_at(int p) {
+        int r = P_[p];
+        P_.erase(P_.begin() + p);
+        pos_[r] = -1;
+        push_free(r);
+        reindex(p);
+    }
+
+    void replace_at(int p, int q) {
+        int r = P_[p];
+        pos_[r] = -1;
+        push_free(r);
+        pop_free(q);
+        P_[p] = q;
+        pos_[q] = p;
+    }
+
+    void reverse(int i, int j) {
+        std::reverse(P_.begin() + i, P_.begin() + j + 1);
+        for (int k = i; k <= j; ++k) pos_[P_[k]] = k;
+    }
+
+    const std::vector<int>& path() const { return P_; }
+    const std::vector<int>& free_list() const { return free_; }
+    int pos(int q) const { return pos_[q]; }
+    int size() const { return (int)P_.size(); }
+
+    double T = 0.0, D = 0.0, V = 0.0;
+    std::uint64_t hash = 0;
+
+private:
+    void reindex(int from) {
+        for (int k = from; k < (int)P_.size(); ++k) pos_[P_[k]] = k;
+    }
+    void push_free(int q) {
+        if (free_idx_[q] >= 0) return;
+        free_idx_[q] = (int)free_.size();
+        free_.push_back(q);
+    }
+    void pop_free(int q) {
+        int k = free_idx_[q];
+        if (k < 0) return;
+        int last = free_.back();
+        free_[k] = last;
+        free_idx_[last] = k;
+        free_.pop_back();
+        free_idx_[q] = -1;
+    }
+
+    const TapInstance& I_;
+    std::vector<int>& P_;
+    std::vector<int>& pos_;        ///< Position dans P_, -1 si libre
+    std::vector<int>& free_;       ///< Requêtes hors trajectoire
+    std::vector<int>& free_idx_;   ///< Position dans free_, -1 si dans P_
+};
+
+} // namespace
+
+std::vector<int> tabu_search(const TapInstance& I, SolverWorkspace& workspace,
+                             const TabuConfig& cfg, const std::vector<int>& initial,
+                             SolverStats* stats, IncumbentTrace* trace,
+                             Checkpointer* checkpoint, RaceLane* lane) {
+    const int n = I.size;
+    // Reprise : compteurs [iter, last_improvement, last_restart, evaluated,
+    // aspirations, cycle_rejections], trajectoires [meilleure, courante]
+    const Checkpoint* resumed = checkpoint ? checkpoint->resumed() : nullptr;
+    if (resumed && (resumed->rng.size() != 1 || resumed->counters.size() != 6
+                    || resumed->routes.size() != 2)) {
+        checkpoint->reject_resume("mal formé");
+        resumed = nullptr;
+    }
+    // Recherche terminée : prolongée seulement si les limites ont été relevées
+    if (resumed && resumed->finished
+        && ((cfg.time_limit_ms > 0 && resumed->elapsed_ms >= cfg.time_limit_ms)
+            || (cfg.max_iters > 0 && resumed->counters[0] >= cfg.max_iters))) {
+        checkpoint->mark_already_finished();
+        return resumed->routes[0];
+    }
+
+    std::vector<int> start = resumed            ? resumed->routes[1]
+                           : initial.empty()    ? greedy_solve(I, workspace, stats, trace)
+                                                : initial;
+    if (n < 2) return start;
+
+    TabuWorkspace& ws = workspace.prepare(n).tabu;
+    SolverStats local;
+    SolverStats& st = stats ? *stats : local;
+    TAP_PHASE_TIMER(st, SolverPhase::TabuSearch);
+
+    // Le temps déjà consommé avant la reprise compte dans time_limit_ms
+    const auto t0 = std::chrono::steady_clock::now()
+        - std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+              std::chrono::duration<double, std::milli>(resumed ? resumed->elapsed_ms : 0.0));
+    auto elapsed_ms = [&]() {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0)
+            .count();
+    };
+    FastRng rng(cfg.seed);
+    std::vector<std::uint64_t>& zobrist = ws.zobrist;
+    zobrist.resize(n);
+    for (auto& z : zobrist) z = rng.next();
+    nearest_neighbours(I, cfg.neighbours, ws);
+    const std::vector<std::vector<int>>& knn = ws.knn;
+
+    // Faisabilité du départ (solution fournie par l'appelant)
+    std::vector<char>& used = ws.used;
+    {
+        used.assign(n, 0);
+        for (int q : start) used[q] = 1;
+        double T = I.solution_time(start), D = I.solution_distance(start);
+        repair_route(I, start, used, T, D);
+    }
+
+    Route cur(I, ws);
+    cur.assign(start, zobrist);
+    // Surcoût des segments inversés par le 2-opt (matrice asymétrique seulement)
+    const bool symmetric = I.dist.symmetric();
+    RoutePrefix<DenseDistances> prefix(DenseDistances{I.dist}, cur.path());
+    std::vector<int> best = resumed ? resumed->routes[0] : cur.path();
+    double bestV = I.solution_interest(best);
+
+    // Poids des ressources dans le score d'un coup, recalculés à chaque
+    // itération : une ressource presque épuisée coûte cher, ce qui oriente
+    // la recherche vers les coups qui la libèrent (2-opt, déplacements,
+    // échanges vers des requêtes plus courtes ou plus proches).
+    double wT = 0.0, wD = 0.0;
+    const double et = std::max(1.0, I.epsilon_t);
+    const double ed = std::max(1.0, I.epsilon_d);
+
+    std::vector<long>& tabu_add_until = ws.add_until;
+    std::vector<long>& tabu_drop_until = ws.drop_until;
+    tabu_add_until.assign(n, 0);
+    tabu_drop_until.assign(n, 0);
+    HashSet& visited = ws.visited;
+    visited.clear();
+    visited.insert(cur.hash);
+
+    std::uint64_t evaluated = 0, aspirations = 0, cycle_rejections = 0;
+    long iter = 0, last_improvement = 0, last_restart = 0;
+    if (resumed) {
+        rng.set_state(resumed->rng[0]);
+        iter = (long)resumed->counters[0];
+        last_improvement = (long)resumed->counters[1];
+        last_restart = (long)resumed->counters[2];
+        evaluated = (std::uint64_t)resumed->counters[3];
+        aspirations = (std::uint64_t)resumed->counters[4];
+        cycle_rejections = (std::uint64_t)resumed->counters[5];
+    }
+    auto snapshot = [&](std::vector<std::vector<int>> routes) {
+        Checkpoint cp;
+        cp.elapsed_ms = elapsed_ms();
+        cp.rng = {rng.state()};
+        cp.counters = {iter, last_improvement, last_restart, (std::int64_t)evaluated,
+                       (std::int64_t)aspirations, (std::int64_t)cycle_rejections};
+        cp.routes = std::move(routes);
+        return cp;
+    };
+    const int sample = std::max(1, cfg.sample);
+    const int tenure_add = std::max(1, cfg.tenure_add);
+    const int tenure_drop = std::max(1, cfg.tenure_drop);
+
+    // Seuil d'aspiration : meilleure solution connue, globale dans une course
+    double aspire = bestV;
+    while (cfg.max_iters <= 0 || iter < cfg.max_iters) {
+        if ((iter & 127) == 0) {
+            if (cfg.time_limit_ms > 0 && elapsed_ms() >= cfg.time_limit_ms) break;
+            if (checkpoint && checkpoint->due()) checkpoint->submit(snapshot({best, cur.path()}));
+            if (lane) {
+                if (!lane->yield(bestV, best)) break;
+                aspire = std::max(bestV, lane->global_best());
+            }
+        }
+        ++iter;
+
+        const std::vector<int>& P = cur.path();
+        const int L = cur.size();
+        wT = cfg.resource_weight * cur.V * (cur.T / et) / et;
+        wD = cfg.resource_weight * cur.V * (cur.D / ed) / ed;
+        Move chosen;
+        Move fallback;     // Meilleur coup interdit, joué si tout le voisinage l'est
+        bool chosen_tabu = false;
+
+        // Retient m s'il bat le meilleur coup de l'itération et n'est pas interdit
+        auto consider = [&](Move& m, bool tabu, bool changes_set, std::uint64_t h) {
+            ++evaluated;
+            m.score = m.dV - wT * m.dT - wD * m.dD;
+            if (m.score <= chosen.score) return;
+            bool aspiration = cur.V + m.dV > aspire + 1e-9;
+            bool forbidden = tabu && !aspiration;
+            if (!forbidden && changes_set && !aspiration && visited.contains(h)) {
+                ++cycle_rejections;
+                forbidden = true;
+            }
+            if (forbidden) {
+                if (m.score > fallback.score) fallback = m;
+                return;
+            }
+            chosen = m;
+            chosen_tabu = tabu;
+        };
+
+        // Ajouts et échanges : requêtes libres tirées au hasard, près de leurs voisins
+        const std::vector<int>& freeList = cur.free_list();
+        for (int s = 0; s < sample && !freeList.empty(); ++s) {
+            const int q = freeList[rng.below((std::uint32_t)freeList.size())];
+            const bool tabuQ = iter < tabu_add_until[q];
+            const bool fitsT = cur.T + I.time[q] <= I.epsilon_t;
+            if (L == 0) {
+                if (!fitsT) continue;
+                Move m;
+                m.kind = MoveKind::Add;
+                m.q = q;
+                m.dV = I.interest[q];
+                m.dT = I.time[q];
+                consider(m, tabuQ, true, cur.hash ^ zobrist[q]);
+                continue;
+            }
+            for (int v : knn[q]) {
+                const int p = cur.pos(v);
+                if (p < 0) continue;
+                if (fitsT) {
+                    for (int at = p; at <= p + 1; ++at) {
+                        double dd = delta_dist_ins(I, P, q, (size_t)at);
+                        if (cur.D + dd > I.epsilon_d) continue;
+                        Move m;
+                        m.kind = MoveKind::Add;
+                        m.q = q;
+                        m.i = at;
+                        m.dV = I.interest[q];
+                        m.dT = I.time[q];
+                        m.dD = dd;
+                        consider(m, tabuQ, true, cur.hash ^ zobrist[q]);
+                    }
+                }
+                // Échange sur place : q remplace son voisin v
+                double dt = I.time[q] - I.time[v];
+                if (cur.T + dt > I.epsilon_t) continue;
+                double dd = 0.0;
+                if (p > 0)     dd += I.dist[P[p - 1]][q] - I.dist[P[p - 1]][v];
+                if (p < L - 1) dd += I.dist[q][P[p + 1]] - I.dist[v][P[p + 1]];
+                if (cur.D + dd > I.epsilon_d) continue;
+                Move m;
+                m.kind = MoveKind::Swap;
+                m.q = q;
+                m.r = v;
+                m.i = p;
+                m.dV = I.interest[q] - I.interest[v];
+                m.dT = dt;
+                m.dD = dd;
+                consider(m, tabuQ || iter < tabu_drop_until[v], true,
+                         cur.hash ^ zobrist[q] ^ zobrist[v]);
+            }
+        }
+
+        // Retraits, déplacements et 2-opt : membres tirés au hasard
+        for (int s = 0; s < sample && L > 0; ++s) {
+            const int i = (int)rng.below((std::uint32_t)L);
+            const int r = P[i];
+            const double rem = delta_dist_rem(I, P, (size_t)i);
+            // Sans inégalité triangulaire, retirer r peut allonger la trajectoire
+            if (cur.D + rem <= I.epsilon_d) {
+                Move m;
+                m.kind = MoveKind::Drop;
+                m.r = r;
+                m.i = i;
+                m.dV = -I.interest[r];
+                m.dT = -I.time[r];
+                m.dD = rem;
+                consider(m, iter < tabu_drop_until[r], true, cur.hash ^ zobrist[r]);
+            }
+            // Déplacement de r juste avant ou après un de ses voisins
+            for (int c : knn[r]) {
+                const int j = cur.pos(c);
+                if (j < 0) continue;
+                for (int side = 0; side < 2; ++side) {
+                    int pa, pb;   // Futurs voisins de r (positions dans P, r exclu)
+                    if (side == 0) {
+                        if (j + 1 == i) continue;
+                        pa = j;
+                        pb = j + 1;
+                    } else {
+                        if (j - 1 == i) continue;
+                        pa = j - 1;
+                        pb = j;
+                    }
+                    const int a = pa >= 0 ? P[pa] : -1;
+                    const int b = pb < L ? P[pb] : -1;
+                    double ins = 0.0;
+                    if (a >= 0) ins += I.dist[a][r];
+                    if (b >= 0) ins += I.dist[r][b];
+                    if (a >= 0 && b >= 0) ins -= I.dist[a][b];
+                    if (rem + ins >= -1e-9) continue;
+                    Move m;
+                    m.kind = MoveKind::Relocate;
+                    m.r = r;
+                    m.i = i;
+                    m.q = c;
+                    m.j = side;
+                    m.dD = rem + ins;
+                    consider(m, false, false, 0);
+                }
+            }
+            if (i + 1 >= L) continue;
+            const int b = P[i + 1];
+            for (int c : knn[r]) {
+                const int j = cur.pos(c);
+                if (j <= i + 1) continue;
+                double delta = I.dist[r][c] - I.dist[r][b];
+                if (j + 1 < L) delta += I.dist[b][P[j + 1]] - I.dist[c][P[j + 1]];
+                if (!symmetric) delta += prefix.reversal_gap(i + 1, j);
+                if (delta >= -1e-9) continue;
+                Move m;
+                m.kind = MoveKind::TwoOpt;
+                m.i = i + 1;
+                m.j = j;
+                m.dD = delta;
+                consider(m, false, false, 0);
+            }
+        }
+
+        if (chosen.score == -std::numeric_limits<double>::infinity()) {
+            if (fallback.score == -std::numeric_limits<double>::infinity()) continue;
+            chosen = fallback;
+        }
+        if (chosen_tabu) ++aspirations;
+
+        // Application du coup
+        switch (chosen.kind) {
+        case MoveKind::Add:
+            cur.insert_at(chosen.q, chosen.i);
+            cur.hash ^= zobrist[chosen.q];
+            tabu_drop_until[chosen.q] = iter + tenure_drop + (long)rng.below(tenure_drop);
+            break;
+        case MoveKind::Swap:
+            cur.replace_at(chosen.i, chosen.q);
+            cur.hash ^= zobrist[chosen.q] ^ zobrist[chosen.r];
+            tabu_drop_until[chosen.q] = iter + tenure_drop + (long)rng.below(tenure_drop);
+            tabu_add_until[chosen.r] = iter + tenure_add + (long)rng.below(tenure_add);
+            break;
+        case MoveKind::Drop:
+            cur.erase_at(chosen.i);
+            cur.hash ^= zobrist[chosen.r];
+            tabu_add_until[chosen.r] = iter + tenure_add + (long)rng.below(tenure_add);
+            break;
+        case MoveKind::Relocate:
+            cur.erase_at(chosen.i);
+            cur.insert_at(chosen.r, cur.pos(chosen.q) + (chosen.j == 0 ? 1 : 0));
+            break;
+        case MoveKind::TwoOpt:
+            cur.reverse(chosen.i, chosen.j);
+            break;
+        }
+        cur.V += chosen.dV;
+        cur.T += chosen.dT;
+        cur.D += chosen.dD;
+        prefix.invalidate();
+        if (chosen.kind != MoveKind::TwoOpt && chosen.kind != MoveKind::Relocate) {
+            visited.insert(cur.hash);
+        }
+
+        if (cur.V > bestV + 1e-9) {
+            bestV = cur.V;
+            aspire = std::max(aspire, bestV);
+            best = cur.path();
+            last_improvement = iter;
+            if (trace) trace->record(bestV, "TabuSearch");
+        } else if (iter - std::max(last_improvement, last_restart) > cfg.restart_after
+                   && cfg.restart_after > 0) {
+            // Diversification : repartir du meilleur privé d'un dixième de ses requêtes
+            last_restart = iter;
+            if (lane && lane->import_better(bestV, best)) bestV = I.solution_interest(best);
+            cur.assign(best, zobrist);
+            prefix.invalidate();
+            int drops = std::max(1, cur.size() / 10);
+            for (int k = 0; k < drops && cur.size() > 0; ++k) {
+                int p = (int)rng.below((std::uint32_t)cur.size());
+                int r = cur.path()[p];
+                cur.D += delta_dist_rem(I, cur.path(), (size_t)p);
+                cur.T -= I.time[r];
+                cur.V -= I.interest[r];
+                cur.hash ^= zobrist[r];
+                cur.erase_at(p);
+                tabu_add_until[r] = iter + tenure_add + (long)rng.below(tenure_add);
+            }
+        }
+    }
+
+    // Finition : 2-opt complet et remplissage du budget libéré
+    double T = I.solution_time(best), D = I.solution_distance(best);
+    std::fill(used.begin(), used.end(), 0);
+    for (int q : best) used[q] = 1;
+    route_two_opt(I, best, D);
+    std::vector<int>& cand = ws.others;
+    cand.clear();
+    for (int q = 0; q < n; ++q) if (!used[q]) cand.push_back(q);
+    std::sort(cand.begin(), cand.end(), [&](int a, int b) {
+        return I.interest[a] * I.time[b] > I.interest[b] * I.time[a];
+    });
+    fill_route(I, best, used, T, D, cand);
+    if (trace) trace->record(I.solution_interest(best), "TabuSearch");
+    if (checkpoint) checkpoint->finish(snapshot({best, cur.path()}));
+
+    TAP_STAT(st.tabu_iterations += (std::uint64_t)iter);
+    TAP_STAT(st.tabu_moves_evaluated += evaluated);
+    TAP_STAT(st.tabu_aspirations += aspirations);
+    TAP_STAT(st.tabu_cycle_rejections += cycle_rejections);
+    (void)evaluated; (void)aspirations; (void)cycle_rejections;
+    st.workspace_bytes = std::max(st.workspace_bytes, workspace.capacity_bytes());
+    return best;
+}
+
+std::vector<int> tabu_search(const TapInstance& I, const TabuConfig& cfg,
+                             const std::vector<int>& initial,
+                             SolverStats* stats, IncumbentTrace* trace,
+                             Checkpointer* checkpoint, RaceLane* lane) {
+    return tabu_search(I, SolverWorkspace::local(), cfg, initial, stats, trace, checkpoint, lane);
+}
@@ -0,0 +1,99 @@
+#ifndef TABU_SEARCH_HPP
+#define TABU_SEARCH_HPP
+
+#include "loaders/TapInstance.hpp"
+#include "solver/Checkpoint.hpp"
+#include "solver/IncumbentTrace.hpp"
+#include "solver/RaceLane.hpp"
+#include "solver/SolverStats.hpp"
+#include "solver/SolverWorkspace.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Paramètres de la recherche tabou.
+ */
+struct TabuConfig {
+    long max_iters = 1000000;      ///< Itérations maximales (0 = pas de limite)
+    double time_limit_ms = 1000.0; ///< Limite de temps (0 = pas de limite)
+    int neighbours = 10;           ///< Taille de la liste de candidats (plus proches voisins)
+    int sample = 16;               ///< Requêtes libres / membres tirés par itération
+    int tenure_add = 10;           ///< Itérations pendant lesquelles une requête retirée ne peut revenir
+    int tenure_drop = 20;          ///< Itérations pendant lesquelles une requête ajoutée ne peut sortir
+    long restart_after = 500;      ///< Itérations sans amélioration avant perturbation du meilleur
+    double resource_weight = 0.5;  ///< Poids du temps et de la distance consommés dans le score
+    std::uint64_t seed = 0;        ///< Graine (tirages, tenures, hachage)
+};
+
+/**
+ * @brief Recherche tabou à partir de la solution gloutonne.
+ *
+ * Voisinages (ceux de GreedySolver, évalués en O(1) par coup) :
+ *   - ajout d'une requête libre à côté d'un de ses plus proches voisins ;
+ *   - échange sur place d'un membre contre une requête libre voisine ;
+ *   - retrait d'un membre ;
+ *   - déplacement d'un membre à côté d'un de ses plus proches voisins ;
+ *   - 2-opt entre un membre et un de ses plus proches voisins.
+ * Chaque itération n'examine que cfg.sample requêtes tirées au hasard et
+ * leurs cfg.neighbours voisins : le nombre de coups évalués ne dépend pas
+ * de n (seule l'application d'un coup est en O(longueur de la trajectoire)).
+ *
+ * Mémoire tabou par attribut : une requête retirée ne peut être ré-ajoutée
+ * pendant tenure_add itérations, une requête ajoutée ne peut être retirée
+ * pendant tenure_drop itérations. Critère d'aspiration : un coup tabou est
+ * accepté s'il améliore la meilleure solution connue. Les ensembles de
+ * requêtes déjà visités sont mémorisés par hachage de Zobrist (mis à jour
+ * en O(1) par coup) ; un coup qui y ramène est refusé, ce qui coupe les
+ * cycles que la liste tabou seule laisse passer. Si tout l'échantillon est
+ * interdit, le meilleur coup interdit est joué. Après restart_after
+ * itérations sans amélioration, la recherche repart du meilleur ensemble
+ * privé d'un dixième de ses requêtes.
+ *
+ * Avec un Checkpointer, l'état (meilleure et courante trajectoires, état
+ * du générateur, compteurs, temps écoulé) est soumis à chaque intervalle ;
+ * une reprise continue la suite de tirages et décompte le temps déjà
+ * consommé de time_limit_ms. La mémoire tabou et les ensembles visités,
+ * reconstruits en quelques centaines d'itérations, ne sont pas sauvegardés.
+ *
+ * Avec un RaceLane (portfolio_solve), la recherche rend la main toutes les
+ * 128 itérations, repart de l'incumbent global s'il bat le sien lors d'une
+ * diversification, et l'aspiration se fait contre l'incumbent global.
+ *
+ * @param instance Instance TAP
+ * @param cfg      Paramètres de la recherche
+ * @param initial  Solution de départ faisable (vide = greedy_solve)
+ * @param stats    Si non nul, reçoit la durée, les itérations et les coups évalués
+ * @param trace    Si non nul, reçoit les incumbents horodatés
+ * @param checkpoint Si non nul, sauvegardes périodiques et reprise éventuelle
+ * @param lane     Si non nul, exécution coopérative dans une course
+ * @return Meilleure séquence trouvée (faisable)
+ */
+std::vector<int> tabu_search(const TapInstance& instance,
+                             const TabuConfig& cfg = TabuConfig(),
+                             const std::vector<int>& initial = {},
+                             SolverStats* stats = nullptr,
+                             IncumbentTrace* trace = nullptr,
+                             Checkpointer* checkpoint = nullptr,
+                             RaceLane* lane = nullptr);
+
+/**
+ * @brief tabu_search dans un espace de travail fourni par l'appelant.
+ *
+ * Liste de candidats, mémoire tabou, ensembles visités et état de la
+ * trajectoire sont pris dans workspace.tabu, la construction gloutonne de
+ * départ dans workspace.greedy : en régime établi, seules les solutions
+ * renvoyées ou sauvegardées sont allouées. La version sans espace de
+ * travail utilise SolverWorkspace::local().
+ *
+ * @param workspace Espace de travail (un seul thread à la fois)
+ */
+std::vector<int> tabu_search(const TapInstance& instance,
+                             SolverWorkspace& workspace,
+                             const TabuConfig& cfg = TabuConfig(),
+                             const std::vector<int>& initial = {},
+                             SolverStats* stats = nullptr,
+                             IncumbentTrace* trace = nullptr,
+                             Checkpointer* checkpoint = nullptr,
+                             RaceLane* lane = nullptr);
+
+#endif // TABU_SEARCH_HPP
@@ -0,0 +1,180 @@
+#include "loaders/InstanceGenerator.hpp"
+#include "loaders/InstanceLoader.hpp"
+#include "solver/GreedySolver.hpp"
+#include "solver/MemeticSolver.hpp"
+#include "solver/TabuSearch.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+/**
+ * @file AllocationReport.cpp
+ * @brief Compte les allocations du tas par résolution (greedy, tabu ou memetic).
+ *
+ * Exemple :
+ *     ./bin/tap_allocs --instance instances/tap_14_400.dat --runs 50
+ *     ./bin/tap_allocs --n 2000 --seed 3
+ *     ./bin/tap_allocs --solver tabu --iters 2000
+ *
+ * Résout la même instance --runs fois de trois façons : avec un
+ * SolverWorkspace neuf à chaque fois, avec un même SolverWorkspace
+ * réutilisé, et par l'appel par défaut (espace du thread, solution
+ * copiée). Affiche le nombre moyen d'allocations et d'octets alloués par
+ * résolution, hors première résolution. tabu et memetic tournent un
+ * nombre fixe d'itérations ou de générations, sans limite de temps, pour
+ * que chaque résolution fasse le même travail.
+ */
+
+namespace {
+
+std::atomic<std::uint64_t> g_allocs{0};
+std::atomic<std::uint64_t> g_bytes{0};
+
+} // namespace
+
+// Remplace l'allocateur global : chaque new passe par le compteur
+void* operator new(std::size_t size) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+struct AllocCount {
+    std::uint64_t allocs = 0;
+    std::uint64_t bytes = 0;
+};
+
+AllocCount snapshot() {
+    return {g_allocs.load(std::memory_order_relaxed), g_bytes.load(std::memory_order_relaxed)};
+}
+
+/// Allocations moyennes des résolutions 2..runs (la première remplit les tampons).
+template <typename Solve>
+AllocCount measure(int runs, Solve&& solve) {
+    solve();
+    AllocCount start = snapshot();
+    for (int r = 1; r < runs; ++r) solve();
+    AllocCount end = snapshot();
+    int n = std::max(1, runs - 1);
+    return {(end.allocs - start.allocs) / n, (end.bytes - start.bytes) / n};
+}
+
+void print_row(const char* label, const AllocCount& c) {
+    std::cout << "  " << std::left << std::setw(30) << label << std::right
+              << std::setw(10) << c.allocs << " allocations" << std::setw(14) << c.bytes
+              << " octets\n";
+}
+
+void usage(const char* prog) {
+    std::cerr << "Usage: " << prog << " [options]\n"
+              << "  --instance FILE     instance .dat (défaut instances/tap_14_400.dat)\n"
+              << "  --specs FILE        epsilons de l'instance (défaut instances/baselines.txt)\n"
+              << "  --n N --seed S      instance synthétique (tap_generate) au lieu d'un fichier\n"
+              << "  --runs K            résolutions par mode (défaut 20)\n"
+              << "  --solver NAME       greedy | tabu | memetic (défaut greedy)\n"
+              << "  --iters N           itérations de tabu, générations de memetic (défaut 1000 / 20)\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string instance_file = "instances/tap_14_400.dat";
+    std::string spec_file = "instances/baselines.txt";
+    GeneratorConfig gen;
+    bool generate = false;
+    int runs = 20;
+    std::string solver = "greedy";
+    long iters = 0;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if      (arg == "--instance") instance_file = next();
+            else if (arg == "--specs")    spec_file = next();
+            else if (arg == "--n")        { gen.n = std::stoi(next()); generate = true; }
+            else if (arg == "--seed")     gen.seed = std::stoull(next());
+            else if (arg == "--runs")     runs = std::max(2, std::stoi(next()));
+            else if (arg == "--solver")   solver = next();
+            else if (arg == "--iters")    iters = std::stol(next());
+            else {
+                usage(argv[0]);
+                return (arg == "--help" || arg == "-h") ? 0 : 1;
+            }
+        }
+
+        TapInstance inst = generate
+            ? generate_instance(gen, "gen_" + std::to_string(gen.n) + "_" + std::to_string(gen.seed))
+            : TapInstance(instance_file, 0.0, 0.0);
+        if (!generate) {
+            std::string name = instance_file.substr(instance_file.find_last_of('/') + 1);
+            bool found = false;
+            for (const auto& spec : load_instance_specs(spec_file)) {
+                if (spec.filename != name) continue;
+                inst.epsilon_t = spec.epsilon_time;
+                inst.epsilon_d = spec.epsilon_distance;
+                found = true;
+            }
+            if (!found) throw std::runtime_error("No epsilon for " + name + " in " + spec_file);
+        }
+
+        TabuConfig tc;
+        tc.time_limit_ms = 0.0;
+        tc.max_iters = iters > 0 ? iters : 1000;
+        MemeticConfig mc;
+        mc.time_limit_ms = 0.0;
+        mc.generations = iters > 0 ? iters : 20;
+        mc.threads = 1;
+        // Résolution dans ws, ou par l'appel par défaut si ws est nul
+        auto solve = [&](SolverWorkspace* ws) {
+            if (solver == "greedy") {
+                if (ws) greedy_solve(inst, *ws);
+                else    greedy_solve(inst);
+            } else if (solver == "tabu") {
+                if (ws) tabu_search(inst, *ws, tc);
+                else    tabu_search(inst, tc);
+            } else if (solver == "memetic") {
+                if (ws) memetic_solve(inst, *ws, mc);
+                else    memetic_solve(inst, mc);
+            } else {
+                throw std::invalid_argument("Unknown solver: " + solver);
+            }
+        };
+
+        std::cout << "Instance " << inst.filename << " (n = " << inst.size << "), solveur "
+                  << solver << ", " << runs << " résolutions par mode\n";
+
+        AllocCount fresh = measure(runs, [&] {
+            SolverWorkspace ws;
+            solve(&ws);
+        });
+        SolverWorkspace ws;
+        AllocCount reused = measure(runs, [&] { solve(&ws); });
+        AllocCount local = measure(runs, [&] { solve(nullptr); });
+
+        std::cout << "Allocations par résolution :\n";
+        print_row("espace de travail neuf", fresh);
+        print_row("espace de travail réutilisé", reused);
+        print_row("appel par défaut (local())", local);
+        std::cout << "Tampons réservés : " << ws.capacity_bytes() << " octets (plus grande instance : "
+                  << ws.largest() << " requêtes, " << ws.runs() << " résolutions)\n";
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur : " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
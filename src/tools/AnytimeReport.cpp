@@ -0,0 +1,259 @@
+#include "loaders/EvaluationLoader.hpp"
+#include "solver/IncumbentTrace.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @file AnytimeReport.cpp
+ * @brief Profils qualité / temps à partir des traces d'incumbents (tap_solver --trace).
+ *
+ * Exemple :
+ *     ./bin/tap_solver --trace run_a.csv
+ *     ./bin/tap_solver --trace run_b.csv      (après modification)
+ *     ./bin/tap_report run_a.csv run_b.csv
+ *
+ * Pour chaque instance de opt.txt présente dans la trace :
+ *  - valeur atteinte à 10 ms, 100 ms, 1 s et 10 s
+ *  - temps pour atteindre un pourcentage de la valeur de opt.txt
+ *  - aire sous la courbe d'écart (primal integral normalisé par l'horizon)
+ * puis un profil de performance agrégé (fraction d'instances à la cible
+ * à chaque instant) et, avec deux traces, la comparaison A / B.
+ */
+
+namespace {
+
+const double kInf = std::numeric_limits<double>::infinity();
+const std::vector<double> kCheckpointsMs = {10.0, 100.0, 1000.0, 10000.0};
+
+using Trace = std::unordered_map<std::string, std::vector<IncumbentEvent>>;
+
+/**
+ * @brief Indicateurs anytime d'une instance pour une exécution.
+ */
+struct AnytimeMetrics {
+    std::vector<double> value_at;        ///< Valeur à chaque checkpoint (-1 = aucune)
+    std::vector<double> time_to_target;  ///< Temps (ms) par cible, kInf si jamais atteinte
+    double gap_area = 1.0;               ///< Écart moyen sur [0, horizon], dans [0, 1]
+};
+
+/// Meilleure valeur connue à l'instant t (-1 si aucune).
+double value_at(const std::vector<IncumbentEvent>& ev, double t) {
+    double v = -1.0;
+    for (const auto& e : ev) {
+        if (e.time_ms > t) break;
+        v = std::max(v, e.value);
+    }
+    return v;
+}
+
+/// Écart relatif à l'optimum, borné à [0, 1] (1 tant qu'aucune solution).
+double gap(double value, double opt) {
+    if (value < 0 || opt <= 0) return 1.0;
+    return std::clamp((opt - value) / opt, 0.0, 1.0);
+}
+
+AnytimeMetrics compute_metrics(const std::vector<IncumbentEvent>& ev, double opt,
+                               const std::vector<double>& targets, double horizon_ms) {
+    AnytimeMetrics m;
+    for (double t : kCheckpointsMs) m.value_at.push_back(value_at(ev, t));
+
+    for (double pct : targets) {
+        double tt = kInf;
+        for (const auto& e : ev) {
+            if (e.value >= opt * pct / 100.0 - 1e-9) { tt = e.time_ms; break; }
+        }
+        m.time_to_target.push_back(tt);
+    }
+
+    // Intégrale de l'écart (fonction en escalier) sur [0, horizon]
+    double area = 0.0, prev_t = 0.0, prev_gap = 1.0;
+    for (const auto& e : ev) {
+        double t = std::min(e.time_ms, horizon_ms);
+        area += prev_gap * (t - prev_t);
+        prev_t = t;
+        prev_gap = std::min(prev_gap, gap(e.value, opt));
+        if (e.time_ms >= horizon_ms) break;
+    }
+    area += prev_gap * (horizon_ms - prev_t);
+    m.gap_area = area / horizon_ms;
+    return m;
+}
+
+std::string fmt_time(double ms) {
+    if (ms == kInf) return "-";
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(ms < 10 ? 3 : 1) << ms;
+    return oss.str();
+}
+
+std::string fmt_value(double v) {
+    if (v < 0) return "-";
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2) << v;
+    return oss.str();
+}
+
+std::string fmt_checkpoint(double ms) {
+    std::ostringstream oss;
+    oss << "@";
+    if (ms >= 1000.0) oss << ms / 1000.0 << "s";
+    else              oss << ms << "ms";
+    return oss.str();
+}
+
+std::string fmt_pct(double pct) {
+    std::ostringstream oss;
+    oss << pct << "%";
+    return oss.str();
+}
+
+std::vector<double> parse_targets(const std::string& text) {
+    std::vector<double> out;
+    std::istringstream iss(text);
+    std::string tok;
+    while (std::getline(iss, tok, ',')) out.push_back(std::stod(tok));
+    return out;
+}
+
+void usage(const char* prog) {
+    std::cerr << "Usage: " << prog << " RUN_A.csv [RUN_B.csv] [options]\n"
+              << "  --opt FILE          valeurs de référence (défaut instances/opt.txt)\n"
+              << "  --targets LIST      cibles en % de opt (défaut 90,95,99,100)\n"
+              << "  --horizon-ms H      horizon de l'aire sous l'écart (défaut 10000)\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<std::string> runs;
+    std::string opt_file = "instances/opt.txt";
+    std::vector<double> targets = {90.0, 95.0, 99.0, 100.0};
+    double horizon_ms = 10000.0;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if      (arg == "--opt")        opt_file = next();
+            else if (arg == "--targets")    targets = parse_targets(next());
+            else if (arg == "--horizon-ms") horizon_ms = std::stod(next());
+            else if (arg.rfind("--", 0) == 0) { usage(argv[0]); return 1; }
+            else runs.push_back(arg);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur : " << e.what() << "\n";
+        return 1;
+    }
+    if (runs.empty() || runs.size() > 2 || horizon_ms <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    auto opt = load_opt_values(opt_file);
+    std::vector<Trace> traces;
+    for (const auto& r : runs) traces.push_back(load_incumbent_trace(r));
+
+    // Instances communes à toutes les traces et connues de opt.txt (ordre stable)
+    std::map<std::string, double> instances;
+    for (const auto& [name, ev] : traces[0]) {
+        if (opt.find(name) == opt.end()) {
+            std::cerr << "Avertissement : '" << name << "' absente de " << opt_file << "\n";
+            continue;
+        }
+        bool everywhere = true;
+        for (const auto& t : traces) everywhere = everywhere && t.count(name);
+        if (everywhere) instances[name] = opt.at(name).value;
+    }
+    if (instances.empty()) {
+        std::cerr << "Erreur : aucune instance commune à analyser\n";
+        return 1;
+    }
+
+    // metrics[run][instance]
+    std::vector<std::map<std::string, AnytimeMetrics>> metrics(traces.size());
+    for (size_t r = 0; r < traces.size(); ++r) {
+        for (const auto& [name, o] : instances) {
+            metrics[r][name] = compute_metrics(traces[r].at(name), o, targets, horizon_ms);
+        }
+    }
+
+    // 1) Détail par instance
+    for (size_t r = 0; r < traces.size(); ++r) {
+        std::cout << "=== Run " << (char)('A' + r) << " : " << runs[r] << " ===\n";
+        std::cout << std::setw(20) << "Instance";
+        for (double t : kCheckpointsMs) std::cout << std::setw(10) << fmt_checkpoint(t);
+        for (double p : targets) std::cout << std::setw(12) << ("TTT" + fmt_pct(p));
+        std::cout << std::setw(10) << "AUC-gap" << "\n";
+        for (const auto& [name, o] : instances) {
+            const AnytimeMetrics& m = metrics[r][name];
+            std::cout << std::setw(20) << name;
+            for (double v : m.value_at) std::cout << std::setw(10) << fmt_value(v);
+            for (double tt : m.time_to_target) std::cout << std::setw(12) << fmt_time(tt);
+            std::cout << std::setw(10) << std::fixed << std::setprecision(4) << m.gap_area << "\n";
+        }
+        std::cout << "\n";
+    }
+
+    // 2) Profil de performance : fraction d'instances à la cible à chaque checkpoint
+    std::cout << "=== Profil de performance (fraction d'instances à la cible) ===\n";
+    std::cout << std::setw(8) << "Run" << std::setw(8) << "Cible";
+    for (double t : kCheckpointsMs) std::cout << std::setw(10) << fmt_checkpoint(t);
+    std::cout << std::setw(12) << "AUC moyen" << "\n";
+    std::vector<double> mean_auc(traces.size(), 0.0);
+    for (size_t r = 0; r < traces.size(); ++r) {
+        for (const auto& [name, m] : metrics[r]) mean_auc[r] += m.gap_area;
+        mean_auc[r] /= (double)instances.size();
+        for (size_t k = 0; k < targets.size(); ++k) {
+            std::cout << std::setw(8) << (char)('A' + r)
+                      << std::setw(8) << fmt_pct(targets[k]);
+            for (double t : kCheckpointsMs) {
+                int hit = 0;
+                for (const auto& [name, m] : metrics[r]) hit += m.time_to_target[k] <= t;
+                std::cout << std::setw(10) << std::setprecision(2)
+                          << (double)hit / (double)instances.size();
+            }
+            std::cout << std::setw(12) << std::setprecision(4) << mean_auc[r] << "\n";
+        }
+    }
+    std::cout << "\n";
+
+    // 3) Comparaison A / B
+    if (traces.size() == 2) {
+        std::cout << "=== Comparaison A -> B ===\n";
+        int faster = 0, slower = 0;
+        for (const auto& [name, o] : instances) {
+            const AnytimeMetrics& a = metrics[0][name];
+            const AnytimeMetrics& b = metrics[1][name];
+            std::cout << std::setw(20) << name
+                      << "  ΔAUC=" << std::showpos << std::setprecision(4)
+                      << (b.gap_area - a.gap_area) << std::noshowpos;
+            for (size_t k = 0; k < targets.size(); ++k) {
+                double ta = a.time_to_target[k], tb = b.time_to_target[k];
+                std::cout << "  TTT" << fmt_pct(targets[k]) << ": "
+                          << fmt_time(ta) << " -> " << fmt_time(tb);
+                if (tb < ta) ++faster;
+                else if (tb > ta) ++slower;
+            }
+            std::cout << "\n";
+        }
+        std::cout << "Cibles atteintes plus tôt : " << faster
+                  << ", plus tard : " << slower << "\n";
+        std::cout << "AUC moyen : " << std::setprecision(4) << mean_auc[0] << " -> "
+                  << mean_auc[1] << (mean_auc[1] < mean_auc[0] ? "  (B meilleur)"
+                                     : mean_auc[1] > mean_auc[0] ? "  (A meilleur)"
+                                                                 : "  (égalité)")
+                  << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include "loaders/InstanceGenerator.hpp"
+
+#include <iostream>
+#include <string>
+
+/**
+ * @file GenerateInstance.cpp
+ * @brief Outil en ligne de commande pour générer des instances TAP synthétiques.
+ *
+ * Exemple :
+ *     ./bin/tap_generate --n 2000 --seed 7 --time int:5:50 --specs instances/gen_specs.txt
+ *
+ * Écrit instances/gen_<n>_<seed>.dat (ou --out) et ajoute la ligne epsilon
+ * correspondante au fichier de spécifications (format baselines.txt).
+ */
+
+static void usage(const char* prog) {
+    std::cerr << "Usage: " << prog << " [options]\n"
+              << "  --n N               nombre de requêtes (défaut 400)\n"
+              << "  --seed S            graine du générateur (défaut 0)\n"
+              << "  --interest LAW      loi des intérêts (défaut uniform:0:1)\n"
+              << "  --time LAW          loi des temps (défaut int:5:50)\n"
+              << "  --grid G            côté de la grille (défaut 5)\n"
+              << "  --metric M          manhattan | chebyshev (défaut manhattan)\n"
+              << "  --eps-time-ratio R  epsilon_time = R * somme des temps (défaut 0.6)\n"
+              << "  --eps-dist-factor F epsilon_distance = F * n (défaut 1.35)\n"
+              << "  --eps-time E        epsilon_time imposé\n"
+              << "  --eps-dist E        epsilon_distance imposé\n"
+              << "  --coords            distances implicites : écrit les coordonnées (fichier O(n))\n"
+              << "  --out FILE          fichier .dat de sortie\n"
+              << "  --specs FILE        fichier de spécifications à compléter\n"
+              << "LAW : uniform:a:b | int:a:b | normal:mu:sigma[:min:max] | exp:mean[:min:max]\n";
+}
+
+int main(int argc, char** argv) {
+    GeneratorConfig cfg;
+    std::string out_file;
+    std::string spec_file;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if      (arg == "--n")               cfg.n = std::stoi(next());
+            else if (arg == "--seed")            cfg.seed = std::stoull(next());
+            else if (arg == "--interest")        cfg.interest = parse_distribution(next());
+            else if (arg == "--time")            cfg.time = parse_distribution(next());
+            else if (arg == "--grid")            cfg.grid_side = std::stoi(next());
+            else if (arg == "--eps-time-ratio")  cfg.epsilon_time_ratio = std::stod(next());
+            else if (arg == "--eps-dist-factor") cfg.epsilon_distance_per_query = std::stod(next());
+            else if (arg == "--eps-time")        cfg.epsilon_time = std::stod(next());
+            else if (arg == "--eps-dist")        cfg.epsilon_distance = std::stod(next());
+            else if (arg == "--coords")          cfg.implicit_distances = true;
+            else if (arg == "--out")             out_file = next();
+            else if (arg == "--specs")           spec_file = next();
+            else if (arg == "--metric") {
+                std::string m = next();
+                if      (m == "manhattan") cfg.metric = GridMetric::Manhattan;
+                else if (m == "chebyshev") cfg.metric = GridMetric::Chebyshev;
+                else throw std::invalid_argument("Unknown metric: " + m);
+            } else {
+                usage(argv[0]);
+                return (arg == "--help" || arg == "-h") ? 0 : 1;
+            }
+        }
+
+        if (out_file.empty()) {
+            out_file = "instances/gen_" + std::to_string(cfg.n) + "_"
+                     + std::to_string(cfg.seed) + (cfg.implicit_distances ? ".coords" : ".dat");
+        }
+        // Nom d'instance = nom de fichier sans répertoire, comme dans baselines.txt
+        std::string name = out_file.substr(out_file.find_last_of('/') + 1);
+
+        TapInstance instance = generate_instance(cfg, name);
+        if (cfg.implicit_distances) {
+            write_instance_coords(instance, out_file);
+        } else {
+            write_instance_dat(instance, out_file);
+        }
+        InstanceSpec spec = make_instance_spec(instance, name);
+        if (!spec_file.empty()) append_instance_spec(spec, spec_file);
+
+        std::cout << spec.filename << ";" << spec.epsilon_time << ";"
+                  << spec.epsilon_distance << "\n";
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur : " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
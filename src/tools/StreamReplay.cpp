@@ -0,0 +1,300 @@
+#include "loaders/InstanceGenerator.hpp"
+#include "loaders/InstanceLoader.hpp"
+#include "solver/IncrementalSolver.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @file StreamReplay.cpp
+ * @brief Banc d'essai de la ré-optimisation incrémentale sur un flux de mises à jour.
+ *
+ * Exemple :
+ *     ./bin/tap_replay --instance instances/tap_14_400.dat --batches 200 --batch-size 10
+ *     ./bin/tap_replay --n 2000 --seed 3 --save-stream flux.csv
+ *     ./bin/tap_replay --n 2000 --seed 3 --stream flux.csv
+ *
+ * Rejoue un flux de lots (synthétique, ou lu depuis --stream) sur
+ * IncrementalSolver et mesure la latence de chaque lot (p50, p95, p99,
+ * max). Tous les --full-every lots, une résolution complète (greedy_solve)
+ * du même état sert de référence de temps et de qualité.
+ *
+ * Format du flux (une mise à jour par ligne) :
+ *     batch;kind;query;value;time
+ * kind = interest | time | remove | add. Pour add, query désigne une
+ * requête existante dont la nouvelle copie les distances (à distance 1
+ * d'elle), value est l'intérêt et time le temps d'exécution.
+ */
+
+namespace {
+
+/**
+ * @brief Mise à jour telle qu'enregistrée dans un flux.
+ */
+struct StreamEvent {
+    int batch = 0;
+    std::string kind;
+    int query = -1;
+    double value = 0.0;
+    double time = 0.0;
+};
+
+using Stream = std::vector<std::vector<StreamEvent>>;
+
+/**
+ * @brief Flux synthétique : ré-estimations bruitées, quelques retraits et ajouts.
+ *
+ * Les indices tiennent compte des ajouts et retraits des lots précédents
+ * (suivi de l'ensemble des requêtes actives).
+ */
+Stream synthetic_stream(const TapInstance& I, int batches, int batch_size, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> U(0.0, 1.0);
+    std::normal_distribution<double> noise(0.0, 0.2);
+
+    std::vector<int> active(I.size);
+    for (int q = 0; q < I.size; ++q) active[q] = q;
+    std::vector<double> interest(I.interest), time(I.time);
+    int next_id = I.size;
+
+    Stream stream(batches);
+    for (int b = 0; b < batches; ++b) {
+        const int batch_start = next_id;   // Une copie ne part que d'une requête déjà chargée
+        for (int k = 0; k < batch_size && !active.empty(); ++k) {
+            StreamEvent e;
+            e.batch = b;
+            size_t slot = (size_t)(U(rng) * active.size()) % active.size();
+            e.query = active[slot];
+            double r = U(rng);
+            if (r < 0.60) {
+                e.kind = "interest";
+                e.value = std::max(0.0, interest[e.query] * (1.0 + noise(rng)));
+                interest[e.query] = e.value;
+            } else if (r < 0.90) {
+                e.kind = "time";
+                e.value = std::max(1.0, std::round(time[e.query] * (1.0 + noise(rng))));
+                time[e.query] = e.value;
+            } else if (r < 0.95) {
+                e.kind = "remove";
+                active[slot] = active.back();
+                active.pop_back();
+            } else if (e.query < batch_start) {
+                e.kind = "add";
+                e.value = U(rng);
+                e.time = time[e.query];
+                interest.push_back(e.value);
+                time.push_back(e.time);
+                active.push_back(next_id++);
+            } else {
+                e.kind = "interest";
+                e.value = U(rng);
+                interest[e.query] = e.value;
+            }
+            stream[b].push_back(e);
+        }
+    }
+    return stream;
+}
+
+Stream load_stream(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("Cannot open stream file: " + path);
+    Stream stream;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#' || line.rfind("batch;", 0) == 0) continue;
+        std::stringstream ss(line);
+        StreamEvent e;
+        std::string tok;
+        std::getline(ss, tok, ';'); e.batch = std::stoi(tok);
+        std::getline(ss, e.kind, ';');
+        std::getline(ss, tok, ';'); e.query = std::stoi(tok);
+        std::getline(ss, tok, ';'); e.value = std::stod(tok);
+        if (std::getline(ss, tok, ';') && !tok.empty()) e.time = std::stod(tok);
+        if (e.batch < 0) throw std::runtime_error("Invalid batch index in " + path);
+        if ((int)stream.size() <= e.batch) stream.resize(e.batch + 1);
+        stream[e.batch].push_back(e);
+    }
+    return stream;
+}
+
+void save_stream(const Stream& stream, const std::string& path) {
+    std::ofstream out(path);
+    if (!out) throw std::runtime_error("Cannot write stream file: " + path);
+    out << "batch;kind;query;value;time\n" << std::setprecision(17);
+    for (const auto& batch : stream) {
+        for (const auto& e : batch) {
+            out << e.batch << ";" << e.kind << ";" << e.query << ";" << e.value << ";"
+                << e.time << "\n";
+        }
+    }
+}
+
+/// Traduit un événement du flux en mise à jour, sur l'état courant du solveur.
+QueryUpdate to_update(const StreamEvent& e, const IncrementalSolver& solver, int size) {
+    if (e.kind == "interest") return QueryUpdate::set_interest(e.query, e.value);
+    if (e.kind == "time")     return QueryUpdate::set_time(e.query, e.value);
+    if (e.kind == "remove")   return QueryUpdate::remove(e.query);
+    if (e.kind == "add") {
+        const TapInstance& I = solver.instance();
+        if (e.query < 0 || e.query >= I.size) {
+            throw std::invalid_argument("add: unknown twin query " + std::to_string(e.query));
+        }
+        // size tient compte des ajouts précédents du même lot
+        std::vector<double> out(size, 0.0), in(size, 0.0);
+        for (int i = 0; i < I.size; ++i) {
+            out[i] = I.dist[e.query][i];
+            in[i] = I.dist[i][e.query];
+        }
+        for (int i = I.size; i < size; ++i) out[i] = in[i] = 1.0;
+        out[e.query] = in[e.query] = 1.0;
+        return QueryUpdate::add(e.value, e.time, std::move(out), std::move(in));
+    }
+    throw std::invalid_argument("Unknown update kind: " + e.kind);
+}
+
+double percentile(std::vector<double> v, double p) {
+    if (v.empty()) return 0.0;
+    std::sort(v.begin(), v.end());
+    size_t idx = (size_t)std::min<double>(v.size() - 1, p * (v.size() - 1) + 0.5);
+    return v[idx];
+}
+
+void usage(const char* prog) {
+    std::cerr << "Usage: " << prog << " [options]\n"
+              << "  --instance FILE     instance .dat (défaut instances/tap_14_400.dat)\n"
+              << "  --specs FILE        epsilons de l'instance (défaut instances/baselines.txt)\n"
+              << "  --n N --seed S      instance synthétique (tap_generate) au lieu d'un fichier\n"
+              << "  --batches B         nombre de lots du flux synthétique (défaut 200)\n"
+              << "  --batch-size K      mises à jour par lot (défaut 10)\n"
+              << "  --stream-seed S     graine du flux synthétique (défaut 1)\n"
+              << "  --stream FILE       rejoue un flux enregistré\n"
+              << "  --save-stream FILE  enregistre le flux rejoué\n"
+              << "  --full-every F      résolution complète de référence tous les F lots (défaut 20)\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string instance_file = "instances/tap_14_400.dat";
+    std::string spec_file = "instances/baselines.txt";
+    std::string stream_file, save_file;
+    GeneratorConfig gen;
+    bool generate = false;
+    int batches = 200, batch_size = 10, full_every = 20;
+    unsigned stream_seed = 1;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if      (arg == "--instance")    instance_file = next();
+            else if (arg == "--specs")       spec_file = next();
+            else if (arg == "--n")           { gen.n = std::stoi(next()); generate = true; }
+            else if (arg == "--seed")        gen.seed = std::stoull(next());
+            else if (arg == "--batches")     batches = std::stoi(next());
+            else if (arg == "--batch-size")  batch_size = std::stoi(next());
+            else if (arg == "--stream-seed") stream_seed = (unsigned)std::stoul(next());
+            else if (arg == "--stream")      stream_file = next();
+            else if (arg == "--save-stream") save_file = next();
+            else if (arg == "--full-every")  full_every = std::max(1, std::stoi(next()));
+            else {
+                usage(argv[0]);
+                return (arg == "--help" || arg == "-h") ? 0 : 1;
+            }
+        }
+
+        TapInstance base = generate
+            ? generate_instance(gen, "gen_" + std::to_string(gen.n) + "_" + std::to_string(gen.seed))
+            : TapInstance(instance_file, 0.0, 0.0);
+        if (!generate) {
+            std::string name = instance_file.substr(instance_file.find_last_of('/') + 1);
+            bool found = false;
+            for (const auto& spec : load_instance_specs(spec_file)) {
+                if (spec.filename != name) continue;
+                base.epsilon_t = spec.epsilon_time;
+                base.epsilon_d = spec.epsilon_distance;
+                found = true;
+            }
+            if (!found) throw std::runtime_error("No epsilon for " + name + " in " + spec_file);
+        }
+
+        Stream stream = stream_file.empty()
+            ? synthetic_stream(base, batches, batch_size, stream_seed)
+            : load_stream(stream_file);
+        if (!save_file.empty()) save_stream(stream, save_file);
+
+        auto t0 = std::chrono::steady_clock::now();
+        IncrementalSolver solver(base);
+        double initial_ms = std::chrono::duration<double, std::milli>(
+                                std::chrono::steady_clock::now() - t0).count();
+
+        std::cout << "Instance " << base.filename << " (n = " << base.size
+                  << ", epsilon_t = " << base.epsilon_t << ", epsilon_d = " << base.epsilon_d
+                  << ")\n"
+                  << "Résolution initiale : " << std::fixed << std::setprecision(2)
+                  << initial_ms << " ms, intérêt " << solver.interest() << "\n\n"
+                  << "   lot   màj   incr(ms)  full(ms)  intérêt incr  intérêt full   écart\n";
+
+        std::vector<double> latencies, full_times, gaps;
+        int updates = 0, invalid = 0;
+        for (size_t b = 0; b < stream.size(); ++b) {
+            std::vector<QueryUpdate> batch;
+            int size = solver.instance().size;
+            for (const auto& e : stream[b]) {
+                batch.push_back(to_update(e, solver, size));
+                if (e.kind == "add") ++size;
+            }
+            UpdateReport rep = solver.apply(batch);
+            latencies.push_back(rep.elapsed_ms);
+            updates += rep.applied;
+
+            if (!solver.is_feasible(solver.solution())) ++invalid;
+
+            if ((b + 1) % (size_t)full_every == 0 || b + 1 == stream.size()) {
+                auto f0 = std::chrono::steady_clock::now();
+                std::vector<int> full = solver.full_solve();
+                double full_ms = std::chrono::duration<double, std::milli>(
+                                     std::chrono::steady_clock::now() - f0).count();
+                double full_val = solver.instance().solution_interest(full);
+                double gap = full_val > 0 ? (full_val - rep.interest_after) / full_val : 0.0;
+                full_times.push_back(full_ms);
+                gaps.push_back(gap);
+                std::cout << std::setw(6) << b + 1 << std::setw(6) << rep.applied
+                          << std::setw(11) << rep.elapsed_ms << std::setw(10) << full_ms
+                          << std::setw(14) << rep.interest_after << std::setw(14) << full_val
+                          << std::setw(7) << std::setprecision(1) << 100.0 * gap << " %\n"
+                          << std::setprecision(2);
+            }
+        }
+
+        double mean_full = 0.0, mean_gap = 0.0;
+        for (double f : full_times) mean_full += f / full_times.size();
+        for (double g : gaps) mean_gap += g / gaps.size();
+        std::cout << "\nLots : " << latencies.size() << ", mises à jour : " << updates
+                  << ", requêtes actives : " << solver.active_count()
+                  << ", solutions invalides : " << invalid << "\n"
+                  << "Latence incrémentale (ms) : p50 " << percentile(latencies, 0.50)
+                  << "  p95 " << percentile(latencies, 0.95)
+                  << "  p99 " << percentile(latencies, 0.99)
+                  << "  max " << percentile(latencies, 1.0) << "\n"
+                  << "Résolution complète (ms)  : moyenne " << mean_full << "\n"
+                  << "Écart moyen à la résolution complète : " << std::setprecision(2)
+                  << 100.0 * mean_gap << " %\n";
+        return invalid == 0 ? 0 : 2;
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur : " << e.what() << "\n";
+        return 1;
+    }
+}